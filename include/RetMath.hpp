@@ -28,6 +28,8 @@ namespace MathConstants {
 
 // Quaternions
 #include "quaternions/quaternion.hpp"
+#include "quaternions/dualquaternion.hpp"
+#include "quaternions/quaternionspline.hpp"
 
 // Geometry
 #include "geometry/plane.hpp"
@@ -35,9 +37,19 @@ namespace MathConstants {
 #include "geometry/rect.hpp"
 #include "geometry/circle.hpp"
 #include "geometry/aabb.hpp"
+#include "geometry/polygon.hpp"
 
 // Transformations
 #include "transformations/transform.hpp"
+#include "transformations/hierarchy.hpp"
+#include "transformations/skinning.hpp"
+
+// Animation
+#include "animation/clip.hpp"
+#include "animation/compressed.hpp"
+#include "animation/pose.hpp"
+#include "animation/ik.hpp"
+#include "animation/tween.hpp"
 
 // Color
 #include "color/color.hpp"
@@ -45,7 +57,17 @@ namespace MathConstants {
 // Utilities
 #include "utilities/random.hpp"
 #include "utilities/interpolation.hpp"
+#include "utilities/easetable.hpp"
+#include "utilities/cubicbezierease.hpp"
+#include "utilities/path.hpp"
+#include "utilities/spline.hpp"
+#include "utilities/grid.hpp"
+#include "utilities/bakedcurve.hpp"
+#include "utilities/polyline.hpp"
 #include "utilities/intersection.hpp"
+#include "utilities/voxelizer.hpp"
+#include "utilities/sdf.hpp"
+#include "utilities/bvh.hpp"
 
 // Aliases for commonly used types
 using Vec2 = Vector2<float>;
@@ -55,6 +77,7 @@ using Mat2 = Matrix2x2<float>;
 using Mat3 = Matrix3x3<float>;
 using Mat4 = Matrix4x4<float>;
 using Quat = Quaternion<float>;
+using DualQuat = DualQuaternion<float>;
 using Rectf = Rect<float>;
 using Circlef = Circle<float>;
 using AABBf = AABB<float>;
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../vectors/vector3.hpp"
+#include "../quaternions/quaternion.hpp"
+#include "../transformations/transform.hpp"
+
+// Keyframed position, rotation and scale channels for one bone.
+// Key times and values are kept in separate arrays per channel, and every
+// channel is sampled independently. Channels without keys leave the
+// corresponding pose component untouched.
+class AnimationTrack {
+public:
+    // Last key index used per channel. Reusing a cursor across calls with
+    // increasing time turns the key search into a short forward scan.
+    struct Cursor {
+        uint32_t position = 0;
+        uint32_t rotation = 0;
+        uint32_t scale = 0;
+    };
+
+    explicit AnimationTrack(uint32_t bone = 0);
+
+    uint32_t getBone() const;
+    void setBone(uint32_t bone);
+
+    // Keys must be added in increasing time order
+    void addPositionKey(float time, const Vector3f& position);
+    void addRotationKey(float time, const Quaternion<float>& rotation);
+    void addScaleKey(float time, const Vector3f& scale);
+    void reserve(size_t positionKeys, size_t rotationKeys, size_t scaleKeys);
+    void clear();
+
+    const std::vector<float>& getPositionTimes() const;
+    const std::vector<Vector3f>& getPositionValues() const;
+    const std::vector<float>& getRotationTimes() const;
+    const std::vector<Quaternion<float>>& getRotationValues() const;
+    const std::vector<float>& getScaleTimes() const;
+    const std::vector<Vector3f>& getScaleValues() const;
+
+    float startTime() const;
+    float endTime() const;
+
+    // Time is clamped to the channel's key range. Positions and scales are
+    // interpolated linearly, rotations with slerp.
+    void sample(float time, Transform<float>& out, Cursor& cursor) const;
+    void sample(float time, Transform<float>& out) const;
+
+private:
+    uint32_t bone;
+    std::vector<float> positionTimes;
+    std::vector<Vector3f> positionValues;
+    std::vector<float> rotationTimes;
+    std::vector<Quaternion<float>> rotationValues;
+    std::vector<float> scaleTimes;
+    std::vector<Vector3f> scaleValues;
+};
+
+// Set of tracks sampled together into a pose buffer indexed by bone
+class AnimationClip {
+public:
+    AnimationClip();
+
+    size_t addTrack(const AnimationTrack& track);
+    size_t addTrack(AnimationTrack&& track);
+    const AnimationTrack& getTrack(size_t index) const;
+    AnimationTrack& getTrack(size_t index);
+    size_t trackCount() const;
+    void clear();
+
+    // Time span covered by the keys of all tracks
+    float startTime() const;
+    float endTime() const;
+    float duration() const;
+
+    // Writes every track into pose[track.getBone()], skipping bones outside
+    // the pose. Pass one cursor per track and keep them between frames for
+    // cheap monotonic playback; they are re-seeked automatically when time
+    // jumps backwards (looping, scrubbing).
+    void sample(float time, std::span<Transform<float>> pose, std::span<AnimationTrack::Cursor> cursors) const;
+    void sample(float time, std::span<Transform<float>> pose) const;
+
+private:
+    std::vector<AnimationTrack> tracks;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "clip.hpp"
+
+// Compressed, read-only form of an AnimationClip.
+// Rotations use smallest-three quantization in 48 bits, positions and scales
+// are stored as 16-bit fractions of their per-channel range and key times as
+// 16-bit ticks over the clip. Keys that can be reproduced by interpolating
+// their decoded neighbours within the given tolerances are dropped. Kept keys
+// are not held to the tolerances: they carry their own quantization error, up
+// to half of range / 65535 per position or scale component, which exceeds
+// the tolerance on channels with a wide range.
+class CompressedClip {
+public:
+    struct Settings {
+        float positionTolerance = 1e-3f;    // World units
+        float rotationTolerance = 1e-3f;    // Radians
+        float scaleTolerance = 1e-3f;
+    };
+
+    CompressedClip();
+
+    static CompressedClip compress(const AnimationClip& clip);
+    static CompressedClip compress(const AnimationClip& clip, const Settings& settings);
+
+    size_t trackCount() const;
+    size_t keyCount() const;        // Keys kept over all channels
+    size_t memoryUsage() const;     // Bytes used by track headers, times and values
+
+    float startTime() const;
+    float endTime() const;
+    float duration() const;
+
+    // Decodes straight into pose[bone], with the same clamping, cursor and
+    // interpolation rules as AnimationClip::sample
+    void sample(float time, std::span<Transform<float>> pose, std::span<AnimationTrack::Cursor> cursors) const;
+    void sample(float time, std::span<Transform<float>> pose) const;
+
+    // Smallest-three codec: the two high bits hold the index of the dropped
+    // largest component, the other three are stored with 15 bits each
+    static void packQuaternion(const Quaternion<float>& rotation, uint16_t out[3]);
+    static Quaternion<float> unpackQuaternion(const uint16_t in[3]);
+
+private:
+    struct Channel {
+        uint32_t first = 0;         // First key in times, and in values times three
+        uint32_t count = 0;
+        Vector3f min;               // Range for positions and scales
+        Vector3f extent;
+    };
+
+    struct Track {
+        uint32_t bone = 0;
+        Channel position;
+        Channel rotation;
+        Channel scale;
+    };
+
+    std::vector<Track> tracks;
+    std::vector<uint16_t> times;
+    std::vector<uint16_t> values;
+    float start;
+    float end;
+    float tickDuration;
+
+    Vector3f decodeVector(const Channel& channel, uint32_t key) const;
+    Quaternion<float> decodeRotation(uint32_t key) const;
+    void sampleTrack(const Track& track, float time, Transform<float>& out, AnimationTrack::Cursor& cursor) const;
+};
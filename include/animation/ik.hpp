@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include "../vectors/vector3.hpp"
+#include "../quaternions/quaternion.hpp"
+
+// Inverse kinematics on flat arrays of world-space joint positions.
+// A chain is stored root first and end effector last; segment lengths are
+// taken from the input positions and preserved by every solver. Optional
+// cone limits give, per joint, the largest angle in radians between the
+// segment entering the joint and the one leaving it (entry 0 is ignored).
+namespace IK {
+    struct Settings {
+        int maxIterations = 16;
+        float tolerance = 1e-3f;    // Distance from end effector to target
+    };
+
+    struct Result {
+        int iterations = 0;
+        float error = 0.0f;         // Final end effector distance to target
+        bool reached = false;
+    };
+
+    // Forward and backward reaching passes over the joint positions
+    Result solveFABRIK(std::span<Vector3f> joints, const Vector3f& target,
+                       const Settings& settings = Settings(), std::span<const float> coneLimits = {});
+
+    // Cyclic coordinate descent: each joint, from the end effector's parent
+    // back to the root, turns its sub-chain to point the effector at the target
+    Result solveCCD(std::span<Vector3f> joints, const Vector3f& target,
+                    const Settings& settings = Settings(), std::span<const float> coneLimits = {});
+
+    // Closed-form solve of a root-mid-end chain. The knee bends towards the
+    // pole point; returns false when the target is out of reach, in which case
+    // the chain is stretched towards it.
+    bool solveTwoBone(const Vector3f& root, Vector3f& mid, Vector3f& end,
+                      const Vector3f& target, const Vector3f& pole);
+
+    // Batch solvers for many chains stored back to back. Chain c covers
+    // joints[chainOffsets[c], chainOffsets[c + 1]) and coneLimits, when given,
+    // uses the same layout. results is optional. Chains are split across threads.
+    void solveFABRIK(std::span<Vector3f> joints, std::span<const uint32_t> chainOffsets,
+                     std::span<const Vector3f> targets, const Settings& settings = Settings(),
+                     std::span<const float> coneLimits = {}, std::span<Result> results = {},
+                     size_t threadCount = 0);
+    void solveCCD(std::span<Vector3f> joints, std::span<const uint32_t> chainOffsets,
+                  std::span<const Vector3f> targets, const Settings& settings = Settings(),
+                  std::span<const float> coneLimits = {}, std::span<Result> results = {},
+                  size_t threadCount = 0);
+    void solveTwoBone(std::span<const Vector3f> roots, std::span<Vector3f> mids, std::span<Vector3f> ends,
+                      std::span<const Vector3f> targets, std::span<const Vector3f> poles,
+                      size_t threadCount = 0);
+
+    // Shortest-arc rotation taking direction from onto direction to
+    Quaternion<float> rotationBetween(const Vector3f& from, const Vector3f& to);
+
+    // Turns each bone's world rotation by the change of its segment direction
+    // between the original and solved joints; the end effector follows its parent
+    void applyChainRotations(std::span<const Vector3f> original, std::span<const Vector3f> solved,
+                             std::span<Quaternion<float>> worldRotations);
+}
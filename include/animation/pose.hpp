@@ -0,0 +1,51 @@
+#pragma once
+#include <span>
+#include <vector>
+#include "../transformations/transform.hpp"
+
+// Local bone transforms stored component by component, so blending loops
+// run over plain float arrays
+struct Pose {
+    std::vector<float> px, py, pz;          // Positions
+    std::vector<float> qw, qx, qy, qz;      // Rotations
+    std::vector<float> sx, sy, sz;          // Scales
+
+    Pose();
+    explicit Pose(size_t boneCount);
+
+    size_t size() const;
+    void resize(size_t boneCount);
+    void setIdentity();
+
+    void setTransform(size_t bone, const Transform<float>& transform);
+    Transform<float> getTransform(size_t bone) const;
+
+    void fromTransforms(std::span<const Transform<float>> transforms);
+    void toTransforms(std::span<Transform<float>> transforms) const;
+};
+
+// Whole-pose blending. Positions and scales are interpolated linearly.
+// Rotations default to a normalized lerp taken in the shortest hemisphere;
+// Slerp keeps constant angular velocity at a higher cost. The output pose is
+// resized to match and may alias either input.
+namespace PoseBlend {
+    enum class RotationMode {
+        Nlerp,
+        Slerp
+    };
+
+    void blend(const Pose& a, const Pose& b, float weight, Pose& out,
+               RotationMode mode = RotationMode::Nlerp);
+
+    // Per-bone weights scaled by weight; bones past the end of the mask keep a
+    void blendMasked(const Pose& a, const Pose& b, std::span<const float> mask, float weight, Pose& out,
+                     RotationMode mode = RotationMode::Nlerp);
+
+    // Difference between pose and reference: position offset, reference
+    // inverse times rotation, and scale ratio
+    void makeAdditive(const Pose& pose, const Pose& reference, Pose& out);
+
+    // Layers an additive pose on top of base, scaled by weight
+    void applyAdditive(const Pose& base, const Pose& additive, float weight, Pose& out,
+                       RotationMode mode = RotationMode::Nlerp);
+}
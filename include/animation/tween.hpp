@@ -0,0 +1,69 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../utilities/interpolation.hpp"
+
+// Many concurrent float tweens updated in one pass. Tweens are stored
+// component by component in one pool per ease type, so a tick is a timing
+// loop, one easeBatch call and a lerp loop per pool. Each tween writes into
+// its target slot of the array passed to update(). Finished and stopped
+// tweens are swap-removed and their handles recycled, so once the pools have
+// grown to their working size no further allocations happen.
+class TweenSystem {
+public:
+    static constexpr size_t EASE_TYPE_COUNT = static_cast<size_t>(Interpolation::EaseType::BounceInOut) + 1;
+
+    struct Handle {
+        uint32_t slot = UINT32_MAX;
+        uint32_t generation = 0;
+    };
+
+    TweenSystem();
+
+    // Preallocates handles, and optionally pool storage for one ease type
+    void reserve(size_t capacity);
+    void reserve(size_t capacity, Interpolation::EaseType type);
+
+    // Starts a tween from from to to over duration seconds. During the
+    // optional delay the target holds from.
+    Handle start(float from, float to, float duration, Interpolation::EaseType type,
+                 uint32_t target, float delay = 0.0f);
+    bool stop(Handle handle);
+    bool isActive(Handle handle) const;
+    void clear();
+
+    // Advances every tween and writes its value to targets[target]. Returns
+    // the number of tweens that finished during this update.
+    size_t update(float deltaTime, std::span<float> targets);
+
+    size_t activeCount() const;
+    size_t activeCount(Interpolation::EaseType type) const;
+
+private:
+    struct Pool {
+        std::vector<float> from, to, invDuration, elapsed;
+        std::vector<float> t, eased;    // Per-update scratch
+        std::vector<uint32_t> target;
+        std::vector<uint32_t> slot;     // Back reference into slots
+
+        size_t size() const { return from.size(); }
+        void reserve(size_t capacity);
+    };
+
+    struct Slot {
+        uint32_t generation = 0;
+        uint32_t index = 0;             // Position in the pool
+        uint8_t type = 0;
+        bool active = false;
+    };
+
+    std::array<Pool, EASE_TYPE_COUNT> pools;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    uint32_t targetLimit;               // One past the largest target slot in use
+    size_t active;
+
+    void remove(Pool& pool, uint32_t index);
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "../vectors/vector2.hpp"
+#include "rect.hpp"
+#include <array>
+#include <cstddef>
+#include <span>
+
+// Convex polygon with fixed-capacity inline storage (no heap allocations).
+// Vertices are stored counter-clockwise; edge normals and bounds are cached
+// when the shape changes so SAT queries only project.
+template<typename T>
+class ConvexPolygon2D {
+public:
+    static constexpr size_t MAX_VERTICES = 16;
+
+    ConvexPolygon2D();
+    ConvexPolygon2D(std::span<const Vector2<T>> points);
+
+    static ConvexPolygon2D fromRect(const Rect<T>& rect);
+    static ConvexPolygon2D regular(const Vector2<T>& center, T radius, size_t sides);
+
+    // Replaces the vertices (at most MAX_VERTICES) and rebuilds the cache
+    void setVertices(std::span<const Vector2<T>> points);
+
+    size_t vertexCount() const;
+    const Vector2<T>& vertex(size_t index) const;
+    const Vector2<T>& normal(size_t index) const; // Outward unit normal of edge (i, i + 1)
+    const Rect<T>& bounds() const;
+    Vector2<T> centroid() const;
+
+    // Rigid moves keep the cached normals valid
+    void translate(const Vector2<T>& offset);
+
+    void project(const Vector2<T>& axis, T& min, T& max) const;
+    bool contains(const Vector2<T>& point) const;
+
+    // SAT with early-out. When mtv is given it receives the minimum translation
+    // that pushes this polygon out of the other one.
+    bool intersects(const ConvexPolygon2D& other, Vector2<T>* mtv = nullptr) const;
+
+private:
+    std::array<Vector2<T>, MAX_VERTICES> vertices;
+    std::array<Vector2<T>, MAX_VERTICES> normals;
+    size_t count;
+    Rect<T> box;
+
+    void rebuild();
+};
+
+using ConvexPolygon2Df = ConvexPolygon2D<float>;
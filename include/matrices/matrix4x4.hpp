@@ -21,6 +21,7 @@ public:
     static Matrix4x4 translation(T x, T y, T z);
     static Matrix4x4 translation(const Vector3<T>& vec);
     static Matrix4x4 scale(T x, T y, T z);
+    static Matrix4x4 scale(const Vector3<T>& vec);
     static Matrix4x4 rotationX(T angle);
     static Matrix4x4 rotationY(T angle);
     static Matrix4x4 rotationZ(T angle);
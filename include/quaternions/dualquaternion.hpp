@@ -0,0 +1,42 @@
+#pragma once
+#include "quaternion.hpp"
+
+// Rigid transform (rotation followed by translation) as a dual quaternion
+// real + eps * dual, where real is the rotation and dual = 0.5 * t * real.
+template<typename T>
+class DualQuaternion {
+private:
+    Quaternion<T> real;
+    Quaternion<T> dual;
+
+public:
+    DualQuaternion();
+    DualQuaternion(const Quaternion<T>& real, const Quaternion<T>& dual);
+    DualQuaternion(const Quaternion<T>& rotation, const Vector3<T>& translation);
+
+    // Components
+    const Quaternion<T>& getReal() const;
+    const Quaternion<T>& getDual() const;
+    Quaternion<T> getRotation() const;
+    Vector3<T> getTranslation() const;
+
+    // Normalization
+    DualQuaternion normalized() const;
+    void normalize();
+
+    // Arithmetic (sums are only rigid again after normalization)
+    DualQuaternion operator+(const DualQuaternion& other) const;
+    DualQuaternion operator*(T scalar) const;
+    DualQuaternion operator*(const DualQuaternion& other) const;
+    DualQuaternion conjugate() const;
+    T dot(const DualQuaternion& other) const;
+
+    // Transformations
+    Vector3<T> transformPoint(const Vector3<T>& point) const;
+    Vector3<T> transformVector(const Vector3<T>& vector) const;
+    Matrix4x4<T> toMatrix() const;
+    static DualQuaternion fromMatrix(const Matrix4x4<T>& mat); // Rigid part only
+};
+
+using DualQuaternionf = DualQuaternion<float>;
+using DualQuaterniond = DualQuaternion<double>;
@@ -1,7 +1,9 @@
 #pragma once
 #include "../vectors/vector3.hpp"
+#include "../matrices/matrix3x3.hpp"
 #include "../matrices/matrix4x4.hpp"
 #include <cmath>
+#include <span>
 
 template<typename T>
 class Quaternion {
@@ -12,6 +14,12 @@ public:
     Quaternion(T w = 1, T x = 0, T y = 0, T z = 0);
     Quaternion(const Vector3<T>& axis, T angle);
     
+    // Components
+    T getW() const;
+    T getX() const;
+    T getY() const;
+    T getZ() const;
+    
     // Normalization
     Quaternion normalized() const;
     void normalize();
@@ -20,22 +28,55 @@ public:
     Quaternion conjugate() const;
     Quaternion inverse() const;
     
+    // Component-wise arithmetic
+    Quaternion operator+(const Quaternion& other) const;
+    Quaternion operator*(T scalar) const;
+    T dot(const Quaternion& other) const;
+    
     // Multiplication
     Quaternion operator*(const Quaternion& other) const;
     Vector3<T> operator*(const Vector3<T>& vec) const;
+    Vector3<T> rotate(const Vector3<T>& vec) const;
     
     // Linear interpolation
     static Quaternion lerp(const Quaternion& a, const Quaternion& b, T t);
     static Quaternion slerp(const Quaternion& a, const Quaternion& b, T t);
     
+    // Approximate slerp for unit quaternions: nlerp along the shortest arc with
+    // t reshaped by a polynomial fitted to the slerp angle profile. No
+    // trigonometry. Max error against slerp is 8e-4 radians for rotations
+    // 180 degrees apart and below 1e-4 radians when |dot| > 0.7.
+    static Quaternion slerpFast(const Quaternion& a, const Quaternion& b, T t);
+    
+    // Batch versions over arrays of pairs, with one t per pair or a shared t;
+    // count is the smallest span size
+    static void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b,
+                      std::span<const T> t, std::span<Quaternion> out);
+    static void slerpFast(std::span<const Quaternion> a, std::span<const Quaternion> b,
+                          std::span<const T> t, std::span<Quaternion> out);
+    static void slerpFast(std::span<const Quaternion> a, std::span<const Quaternion> b,
+                          T t, std::span<Quaternion> out);
+    
     // Transformations
     Matrix4x4<T> toMatrix() const;
     static Quaternion fromMatrix(const Matrix4x4<T>& mat);
+    static Quaternion fromMatrix(const Matrix3x3<T>& mat);
+    
+    // From the entries of a pure rotation matrix, row by row, without
+    // building a matrix object
+    static Quaternion fromRotation(T m00, T m01, T m02,
+                                   T m10, T m11, T m12,
+                                   T m20, T m21, T m22);
     
     // Axis and angle
     void toAxisAngle(Vector3<T>& axis, T& angle) const;
     static Quaternion fromAxisAngle(const Vector3<T>& axis, T angle);
     
+    // Exponential map of unit quaternions: log returns axis * half angle,
+    // exp turns such a vector back into a rotation
+    Vector3<T> log() const;
+    static Quaternion exp(const Vector3<T>& v);
+    
     // Euler angles
     static Quaternion fromEuler(T pitch, T yaw, T roll);
     Vector3<T> toEuler() const;
@@ -0,0 +1,61 @@
+#pragma once
+#include <span>
+#include <vector>
+#include "quaternion.hpp"
+
+// C1-continuous rotation curve through a list of unit quaternion keys. The
+// parameter u runs over [0, segmentCount()], segment i joining keys i and
+// i + 1. Keys are moved into a common hemisphere when the curve is built.
+//
+// Squad blends a slerp between the keys with a slerp between precomputed
+// inner control quaternions. Hermite uses the cumulative cubic form in the
+// exponential map, which also accepts explicit angular velocities.
+// Control values are computed once per segment; evaluation is then a few
+// slerps (Squad) or exponentials (Hermite).
+template<typename T>
+class QuaternionSpline {
+public:
+    enum class Mode {
+        Squad,
+        Hermite
+    };
+
+    QuaternionSpline();
+    explicit QuaternionSpline(std::span<const Quaternion<T>> keys, Mode mode = Mode::Squad);
+    QuaternionSpline(std::span<const Quaternion<T>> keys, std::span<const Vector3<T>> angularVelocities);
+
+    // Tangents at each key are estimated from its neighbours (Catmull-Rom style)
+    void build(std::span<const Quaternion<T>> keys, Mode mode = Mode::Squad);
+
+    // Hermite curve with an angular velocity per key, in radians per segment
+    // and expressed in the key's local frame
+    void build(std::span<const Quaternion<T>> keys, std::span<const Vector3<T>> angularVelocities);
+
+    Quaternion<T> evaluate(T u) const;
+    void evaluate(std::span<const T> u, std::span<Quaternion<T>> out) const;
+
+    size_t segmentCount() const;
+    Mode getMode() const;
+
+private:
+    struct SquadSegment {
+        Quaternion<T> q0, q1;       // Keys
+        Quaternion<T> s0, s1;       // Inner control quaternions
+    };
+
+    struct HermiteSegment {
+        Quaternion<T> q0;
+        Vector3<T> w1, w2, w3;      // Log-space steps of the Bezier control polygon
+    };
+
+    Mode mode;
+    std::vector<SquadSegment> squad;
+    std::vector<HermiteSegment> hermite;
+    Quaternion<T> single;           // The only key of a one-key curve
+
+    void buildHermite(std::span<const Quaternion<T>> keys, std::span<const Vector3<T>> tangents);
+    Quaternion<T> evaluateSegment(size_t segment, T t) const;
+};
+
+using QuaternionSplinef = QuaternionSpline<float>;
+using QuaternionSplined = QuaternionSpline<double>;
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "transform.hpp"
+
+// Flattened transform hierarchy.
+// Local TRS components live in separate arrays indexed by node, and every
+// parent index is smaller than its children, so world matrices are produced
+// by one linear pass. Only nodes whose local transform or ancestors changed
+// since the last update are recomputed.
+template<typename T>
+class TransformHierarchy {
+public:
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFFu;
+
+    TransformHierarchy();
+
+    void reserve(size_t count);
+    void clear();
+    size_t size() const;
+
+    // Parent must be NO_PARENT or an existing node
+    uint32_t addNode(uint32_t parent, const Transform<T>& local = Transform<T>());
+
+    // Reparenting keeps the topological order, so the new parent must precede the node
+    void setParent(uint32_t node, uint32_t parent);
+    uint32_t getParent(uint32_t node) const;
+
+    // Local transform (marks the node dirty)
+    void setLocalPosition(uint32_t node, const Vector3<T>& position);
+    void setLocalRotation(uint32_t node, const Quaternion<T>& rotation);
+    void setLocalScale(uint32_t node, const Vector3<T>& scale);
+    void setLocalTransform(uint32_t node, const Transform<T>& local);
+    Transform<T> getLocalTransform(uint32_t node) const;
+
+    const std::vector<Vector3<T>>& getLocalPositions() const;
+    const std::vector<Quaternion<T>>& getLocalRotations() const;
+    const std::vector<Vector3<T>>& getLocalScales() const;
+    const std::vector<uint32_t>& getParents() const;
+
+    bool isDirty(uint32_t node) const;
+    void markDirty(uint32_t node);
+    void markAllDirty();
+
+    // Recomputes world matrices of dirty nodes and their descendants;
+    // returns the number of nodes recomputed
+    size_t updateWorldMatrices();
+
+    // Same result as updateWorldMatrices, bit for bit. The tree is cut at the
+    // level whose subtrees balance best over the workers; the nodes above the
+    // cut are updated on the calling thread, then each worker updates its
+    // share of subtrees, with one thread launch per call. Falls back to
+    // updateWorldMatrices for one worker or when no cut pays off.
+    size_t updateWorldMatricesParallel(size_t threadCount = 0);
+
+    uint32_t getDepth(uint32_t node) const;
+    size_t levelCount() const;
+
+    const Matrix4x4<T>& getWorldMatrix(uint32_t node) const;
+    const std::vector<Matrix4x4<T>>& getWorldMatrices() const;
+
+    // Reference path: composes local transforms up to the root with Transform::combine.
+    // Agrees with the world matrices only to rounding, since it composes TRS
+    // components rather than multiplying matrices.
+    Transform<T> computeWorldTransform(uint32_t node) const;
+
+private:
+    std::vector<Vector3<T>> localPositions;
+    std::vector<Quaternion<T>> localRotations;
+    std::vector<Vector3<T>> localScales;
+    std::vector<uint32_t> parents;
+    std::vector<uint8_t> dirty;
+    std::vector<Matrix4x4<T>> worldMatrices;
+    size_t dirtyCount;
+
+    // Subtree partition for the parallel update, rebuilt after structural
+    // changes or when the worker count changes. Each list is in index order.
+    std::vector<uint32_t> depths;
+    std::vector<uint32_t> prefixNodes;      // Nodes above the split level
+    std::vector<uint32_t> bucketNodes;      // One bucket of subtrees per worker
+    std::vector<size_t> bucketOffsets;
+    size_t partitionWorkers;
+    bool partitionDirty;
+
+    void computeWorldMatrix(uint32_t node);
+    size_t updateNodes(const uint32_t* nodes, size_t count);
+    void rebuildPartition(size_t workers);
+};
+
+using TransformHierarchyf = TransformHierarchy<float>;
+using TransformHierarchyd = TransformHierarchy<double>;
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include "../vectors/vector3.hpp"
+#include "../matrices/matrix4x4.hpp"
+#include "../quaternions/dualquaternion.hpp"
+
+// Batch vertex skinning with four bone influences per vertex.
+// Vertex data is read from parallel streams and skinned positions (and
+// optionally normals) are written as separate x, y, z arrays.
+namespace Skinning {
+    constexpr size_t INFLUENCES = 4;
+
+    struct VertexStreams {
+        std::span<const Vector3f> positions;
+        std::span<const Vector3f> normals;      // Optional, empty to skip
+        std::span<const uint32_t> boneIndices;  // INFLUENCES per vertex
+        std::span<const float> weights;         // INFLUENCES per vertex, summing to 1
+    };
+
+    struct OutputStreams {
+        std::span<float> x, y, z;               // Positions, one entry per vertex
+        std::span<float> nx, ny, nz;            // Normals, written only when normals are given
+    };
+
+    // Linear blend skinning: vertices are transformed by the weighted sum of
+    // bone matrices. Normals use the blended 3x3 part and are renormalized.
+    void linearBlend(const VertexStreams& vertices, std::span<const Matrix4x4<float>> bones,
+                     const OutputStreams& out, size_t threadCount = 0);
+
+    // Dual quaternion skinning: bone transforms are blended as dual quaternions
+    // (sign-aligned to the first influence) and normalized, which preserves
+    // volume around twisting joints. Bones must be rigid.
+    void dualQuaternion(const VertexStreams& vertices, std::span<const DualQuaternion<float>> bones,
+                        const OutputStreams& out, size_t threadCount = 0);
+
+    // Converts rigid bone matrices for dualQuaternion
+    void toDualQuaternions(std::span<const Matrix4x4<float>> matrices, std::span<DualQuaternion<float>> out);
+}
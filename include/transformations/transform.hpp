@@ -2,6 +2,7 @@
 #include "../vectors/vector3.hpp"
 #include "../quaternions/quaternion.hpp"
 #include "../matrices/matrix4x4.hpp"
+#include <span>
 
 template<typename T>
 class Transform {
@@ -19,10 +20,7 @@ public:
         return buildModelMatrix(position, rotation, scale);
     }
     Matrix4x4<T> getInverseModelMatrix() const { 
-        Matrix4x4<T> translationMat = Matrix4x4<T>::translation(-position);
-        Matrix4x4<T> rotationMat = rotation.inverse().toMatrix();
-        Matrix4x4<T> scaleMat = Matrix4x4<T>::scaling(Vector3<T>(1/scale.x, 1/scale.y, 1/scale.z));
-        return scaleMat * rotationMat * translationMat;
+        return buildInverseModelMatrix(position, rotation, scale);
     }
     
     // Legacy aliases for compatibility
@@ -34,27 +32,40 @@ public:
         return getModelMatrix().transformPoint(point);
     }
     Vector3<T> transformVector(const Vector3<T>& vector) const {   // Direction vectors (no translation)
-        return rotation.rotate(vector) * scale; // Apply rotation and scale only
+        return rotation.rotate(vector * scale); // Apply scale and rotation only
     }
     Vector3<T> inverseTransformPoint(const Vector3<T>& point) const { // World space -> Model space
         return getInverseModelMatrix().transformPoint(point);
     }
     
     // Space transformation helpers
+    // Closed-form T * R * S and its inverse, written straight from the
+    // (unit) quaternion without intermediate matrices or products
     static Matrix4x4<T> buildModelMatrix(const Vector3<T>& position, 
                                         const Quaternion<T>& rotation, 
-                                        const Vector3<T>& scale) {
-        Matrix4x4<T> translationMat = Matrix4x4<T>::translation(position);
-        Matrix4x4<T> rotationMat = rotation.toMatrix();
-        Matrix4x4<T> scaleMat = Matrix4x4<T>::scaling(scale);
-        return translationMat * rotationMat * scaleMat;
-    }
+                                        const Vector3<T>& scale);
+    static Matrix4x4<T> buildInverseModelMatrix(const Vector3<T>& position,
+                                               const Quaternion<T>& rotation,
+                                               const Vector3<T>& scale);
+    
+    // Batch versions; out must hold at least transforms.size() matrices
+    static void buildModelMatrices(std::span<const Transform> transforms, std::span<Matrix4x4<T>> out);
+    static void buildInverseModelMatrices(std::span<const Transform> transforms, std::span<Matrix4x4<T>> out);
     
     static Transform fromModelMatrix(const Matrix4x4<T>& matrix);
     
     // Transformation decomposition
     void decomposeModelMatrix(const Matrix4x4<T>& matrix);
     
+    // Batch decomposition; out must hold at least matrices.size() transforms
+    static void decomposeModelMatrices(std::span<const Matrix4x4<T>> matrices, std::span<Transform> out);
+    
+    // For matrices with shear: the rotation comes from the polar decomposition
+    // of the upper 3x3 and the scale from the diagonal of its stretch part,
+    // so the shear is dropped instead of leaking into the rotation
+    static Transform fromModelMatrixPolar(const Matrix4x4<T>& matrix);
+    static void decomposeModelMatricesPolar(std::span<const Matrix4x4<T>> matrices, std::span<Transform> out);
+    
     // Combining transformations (parent * child)
     Transform combine(const Transform& child) const;
     
@@ -0,0 +1,67 @@
+#pragma once
+#include <functional>
+#include <span>
+#include <vector>
+#include "interpolation.hpp"
+#include "path.hpp"
+#include "../color/color.hpp"
+
+// Any curve of one parameter sampled into a fixed-resolution table over
+// [start, end], so playback is an index computation and one lerp regardless
+// of what the curve was. Inputs outside the range are clamped, NaN to start.
+// Typical use is particle properties over lifetime, sampled in bulk from an
+// age array.
+template<typename T>
+class BakedCurve {
+public:
+    static constexpr size_t DEFAULT_RESOLUTION = 64;
+
+    BakedCurve();
+    explicit BakedCurve(const std::function<T(float)>& curve, size_t resolution = DEFAULT_RESOLUTION,
+                        float start = 0.0f, float end = 1.0f);
+
+    // Samples curve at resolution evenly spaced points, resolution >= 2
+    void bake(const std::function<T(float)>& curve, size_t resolution = DEFAULT_RESOLUTION,
+              float start = 0.0f, float end = 1.0f);
+
+    T sample(float x) const;
+    T operator()(float x) const;
+    void sample(std::span<const float> x, std::span<T> out) const;
+    // Samples at age / lifetime, the usual particle over-lifetime lookup
+    void sample(std::span<const float> ages, std::span<const float> lifetimes, std::span<T> out) const;
+
+    size_t resolution() const;
+    float getStart() const;
+    float getEnd() const;
+    const std::vector<T>& getValues() const;
+
+private:
+    std::vector<T> values;  // Samples, with the last one repeated so lookups need no bounds check
+    float start;
+    float scale;            // (resolution - 1) / (end - start)
+};
+
+// Color key of a gradient
+struct GradientStop {
+    float position;
+    Color color;
+};
+
+// Bakers for the library's curve types
+namespace CurveBaking {
+    BakedCurve<float> bakeEase(Interpolation::EaseType type, float from = 0.0f, float to = 1.0f,
+                               size_t resolution = BakedCurve<float>::DEFAULT_RESOLUTION);
+
+    template<typename T>
+    BakedCurve<T> bakeBezier(const T& p0, const T& p1, const T& p2, const T& p3,
+                             size_t resolution = BakedCurve<T>::DEFAULT_RESOLUTION);
+
+    // Constant-speed samples along the path
+    template<typename T>
+    BakedCurve<T> bakePath(const Path<T>& path, size_t resolution = BakedCurve<T>::DEFAULT_RESOLUTION);
+
+    // Stops must be sorted by position (throws otherwise); colors are clamped
+    // past the first and last stop
+    BakedCurve<Color> bakeGradient(std::span<const GradientStop> stops,
+                                   size_t resolution = BakedCurve<Color>::DEFAULT_RESOLUTION);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include "../vectors/vector3.hpp"
+#include "../geometry/aabb.hpp"
+
+// Bounding volume hierarchy over an indexed triangle mesh.
+// Nodes are stored depth-first: the left child directly follows its parent.
+class MeshBVH {
+public:
+    static constexpr uint32_t MAX_LEAF_TRIANGLES = 4;
+
+    struct Node {
+        AABBf bounds;
+        uint32_t first;     // Leaf: first triangle, inner: right child index
+        uint32_t count;     // Triangles in the leaf, 0 for inner nodes
+    };
+
+    struct ClosestHit {
+        Vector3f point;
+        float distance = std::numeric_limits<float>::max();
+        uint32_t triangle = std::numeric_limits<uint32_t>::max();
+
+        bool found() const { return triangle != std::numeric_limits<uint32_t>::max(); }
+    };
+
+    MeshBVH();
+    MeshBVH(std::span<const Vector3f> vertices, std::span<const uint32_t> indices);
+
+    void build(std::span<const Vector3f> vertices, std::span<const uint32_t> indices);
+
+    const std::vector<Node>& getNodes() const;
+    size_t triangleCount() const;
+    AABBf getBounds() const;
+
+    // Triangle corners in BVH order; originalIndex maps back to the input mesh
+    void getTriangle(uint32_t triangle, Vector3f& a, Vector3f& b, Vector3f& c) const;
+    uint32_t originalIndex(uint32_t triangle) const;
+
+    // Closest point on the mesh within maxDistance. Subtrees farther than the
+    // best distance found so far are skipped, nearer children are visited first.
+    ClosestHit closestPointOnMesh(const Vector3f& point,
+                                  float maxDistance = std::numeric_limits<float>::max()) const;
+    void closestPointsOnMesh(std::span<const Vector3f> points, std::span<ClosestHit> hits,
+                             float maxDistance = std::numeric_limits<float>::max(),
+                             size_t threadCount = 0) const;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<Vector3f> corners;      // Three per triangle, BVH order
+    std::vector<uint32_t> triangleIds;  // BVH order -> input triangle
+
+    uint32_t buildRecursive(std::vector<uint32_t>& order, std::vector<Vector3f>& centroids,
+                            std::vector<AABBf>& boxes, uint32_t begin, uint32_t end);
+};
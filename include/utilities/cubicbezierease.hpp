@@ -0,0 +1,44 @@
+#pragma once
+#include <array>
+#include <span>
+
+// CSS cubic-bezier(x1, y1, x2, y2) timing function. The curve runs from (0, 0)
+// to (1, 1); evaluating it means solving x(s) = t for the curve parameter s
+// and returning y(s). A table of x at evenly spaced s gives the starting
+// guess, refined by Newton-Raphson, or by bisection where the slope is too
+// flat for Newton to converge.
+class CubicBezierEase {
+public:
+    static constexpr size_t SAMPLE_COUNT = 11;
+
+    CubicBezierEase();      // Linear
+    CubicBezierEase(float x1, float y1, float x2, float y2);
+
+    // The CSS keyword curves
+    static CubicBezierEase ease();
+    static CubicBezierEase easeIn();
+    static CubicBezierEase easeOut();
+    static CubicBezierEase easeInOut();
+
+    // Eased value for t, clamped to [0, 1]
+    float evaluate(float t) const;
+    float operator()(float t) const;
+    void evaluate(std::span<const float> t, std::span<float> out) const;
+
+    float getX1() const;
+    float getY1() const;
+    float getX2() const;
+    float getY2() const;
+
+private:
+    float x1, y1, x2, y2;
+    float ax, bx, cx;       // x(s) = ((ax s + bx) s + cx) s
+    float ay, by, cy;
+    bool linear;
+    std::array<float, SAMPLE_COUNT> samples;
+
+    float curveX(float s) const;
+    float curveY(float s) const;
+    float slopeX(float s) const;
+    float solveParameter(float x) const;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <functional>
+#include <span>
+#include <vector>
+#include "interpolation.hpp"
+
+// Easing curve baked into a uniform table over t in [0, 1]. Lookups cost one
+// index computation and a linear or Catmull-Rom blend of neighbouring samples,
+// regardless of how expensive the source curve is. Input t is clamped, NaN to 0.
+class EaseTable {
+public:
+    enum class Reconstruction {
+        Linear,
+        Cubic
+    };
+
+    static constexpr size_t DEFAULT_SIZE = 256;
+
+    EaseTable();
+    explicit EaseTable(Interpolation::EaseType type, size_t size = DEFAULT_SIZE,
+                       Reconstruction reconstruction = Reconstruction::Linear);
+    explicit EaseTable(const std::function<float(float)>& function, size_t size = DEFAULT_SIZE,
+                       Reconstruction reconstruction = Reconstruction::Linear);
+
+    // Samples the curve at size evenly spaced points, size must be at least 2
+    void bake(Interpolation::EaseType type, size_t size = DEFAULT_SIZE,
+              Reconstruction reconstruction = Reconstruction::Linear);
+    void bake(const std::function<float(float)>& function, size_t size = DEFAULT_SIZE,
+              Reconstruction reconstruction = Reconstruction::Linear);
+
+    // Smallest power-of-two table, up to maxSize, whose error against the
+    // curve stays within tolerance
+    static EaseTable withTolerance(const std::function<float(float)>& function, float tolerance,
+                                   Reconstruction reconstruction = Reconstruction::Linear,
+                                   size_t maxSize = 65536);
+    static EaseTable withTolerance(Interpolation::EaseType type, float tolerance,
+                                   Reconstruction reconstruction = Reconstruction::Linear,
+                                   size_t maxSize = 65536);
+
+    float sample(float t) const;
+    float operator()(float t) const;
+    void sample(std::span<const float> t, std::span<float> out) const;
+
+    // Largest absolute difference from the curve over evenly spaced points
+    float maxError(const std::function<float(float)>& function, size_t samples = 4096) const;
+
+    size_t size() const;
+    Reconstruction getReconstruction() const;
+
+private:
+    std::vector<float> values;  // Samples offset by one, padded by an extrapolated value at each end
+    float scale;                // size - 1
+    Reconstruction reconstruction;
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../vectors/vector2.hpp"
+#include "../vectors/vector3.hpp"
+
+// Storage order of grid nodes. Blocked and Morton group nodes into tiles of
+// BLOCK nodes per axis so that the corners of a cell usually share a cache
+// line; Morton additionally orders each tile along a Z-order curve.
+enum class GridLayout {
+    Linear,
+    Blocked,
+    Morton
+};
+
+// Handling of positions outside the grid. Clamp holds the edge values;
+// Wrap treats the grid as periodic, interpolating between the last and
+// first node.
+enum class GridAddress {
+    Clamp,
+    Wrap
+};
+
+// Scalar values on a regular 2D lattice of nodes, e.g. a heightmap. Node
+// (x, y) sits at origin + (x, y) * cellSize; sampling is bilinear.
+template<typename T>
+class Grid2D {
+public:
+    static constexpr int BLOCK = 8;
+
+    Grid2D();
+    Grid2D(int width, int height, GridLayout layout = GridLayout::Linear, float cellSize = 1.0f,
+           const Vector2f& origin = Vector2f());
+
+    int getWidth() const;
+    int getHeight() const;
+    GridLayout getLayout() const;
+    float getCellSize() const;
+    const Vector2f& getOrigin() const;
+    GridAddress getAddressMode() const;
+    void setAddressMode(GridAddress mode);
+
+    T get(int x, int y) const;
+    void set(int x, int y, T value);
+    void fill(T value);
+    // Copies row-major values (width * height) in, or out
+    void setValues(std::span<const T> values);
+    void getValues(std::span<T> values) const;
+
+    T sample(const Vector2f& position) const;
+    Vector2<T> gradient(const Vector2f& position) const;    // Per world unit
+    void sample(std::span<const Vector2f> positions, std::span<T> out) const;
+    void gradient(std::span<const Vector2f> positions, std::span<Vector2<T>> out) const;
+
+private:
+    int width, height;
+    int tilesX;
+    GridLayout layout;
+    GridAddress address;
+    float cellSize;
+    Vector2f origin;
+    std::vector<T> values;
+
+    size_t index(int x, int y) const;
+    // Cell corners around a position and the fractional offset inside it
+    template<GridLayout Layout>
+    void locate(const Vector2f& position, T corners[4], float& tx, float& ty) const;
+    template<GridLayout Layout>
+    T sampleWith(const Vector2f& position) const;
+    template<GridLayout Layout>
+    Vector2<T> gradientWith(const Vector2f& position) const;
+};
+
+// Scalar values on a regular 3D lattice of nodes, e.g. a density volume.
+// Node (x, y, z) sits at origin + (x, y, z) * cellSize; sampling is trilinear.
+template<typename T>
+class Grid3D {
+public:
+    static constexpr int BLOCK = 4;
+
+    Grid3D();
+    Grid3D(int width, int height, int depth, GridLayout layout = GridLayout::Linear,
+           float cellSize = 1.0f, const Vector3f& origin = Vector3f());
+
+    int getWidth() const;
+    int getHeight() const;
+    int getDepth() const;
+    GridLayout getLayout() const;
+    float getCellSize() const;
+    const Vector3f& getOrigin() const;
+    GridAddress getAddressMode() const;
+    void setAddressMode(GridAddress mode);
+
+    T get(int x, int y, int z) const;
+    void set(int x, int y, int z, T value);
+    void fill(T value);
+    // Copies x-fastest values (width * height * depth) in, or out
+    void setValues(std::span<const T> values);
+    void getValues(std::span<T> values) const;
+
+    T sample(const Vector3f& position) const;
+    Vector3<T> gradient(const Vector3f& position) const;    // Per world unit
+    void sample(std::span<const Vector3f> positions, std::span<T> out) const;
+    void gradient(std::span<const Vector3f> positions, std::span<Vector3<T>> out) const;
+
+private:
+    int width, height, depth;
+    int tilesX, tilesY;
+    GridLayout layout;
+    GridAddress address;
+    float cellSize;
+    Vector3f origin;
+    std::vector<T> values;
+
+    size_t index(int x, int y, int z) const;
+    template<GridLayout Layout>
+    void locate(const Vector3f& position, T corners[8], float& tx, float& ty, float& tz) const;
+    template<GridLayout Layout>
+    T sampleWith(const Vector3f& position) const;
+    template<GridLayout Layout>
+    Vector3<T> gradientWith(const Vector3f& position) const;
+};
+
+using Grid2Df = Grid2D<float>;
+using Grid3Df = Grid3D<float>;
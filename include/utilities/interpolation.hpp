@@ -1,6 +1,7 @@
 #pragma once
 #include <cmath>
 #include <functional>
+#include <span>
 #include <vector>
 #include "../vectors/vector2.hpp"
 #include "../vectors/vector3.hpp"
@@ -48,42 +49,208 @@ namespace Interpolation {
         BounceInOut
     };
     
+    // Defined inline so template-dispatched and batch easing can inline them
     namespace EaseFunctions {
-        float linear(float t);
-        float sineIn(float t);
-        float sineOut(float t);
-        float sineInOut(float t);
-        float quadIn(float t);
-        float quadOut(float t);
-        float quadInOut(float t);
-        float cubicIn(float t);
-        float cubicOut(float t);
-        float cubicInOut(float t);
-        float quartIn(float t);
-        float quartOut(float t);
-        float quartInOut(float t);
-        float quintIn(float t);
-        float quintOut(float t);
-        float quintInOut(float t);
-        float expoIn(float t);
-        float expoOut(float t);
-        float expoInOut(float t);
-        float circIn(float t);
-        float circOut(float t);
-        float circInOut(float t);
-        float backIn(float t);
-        float backOut(float t);
-        float backInOut(float t);
-        float elasticIn(float t);
-        float elasticOut(float t);
-        float elasticInOut(float t);
-        float bounceOut(float t);
-        float bounceIn(float t);
-        float bounceInOut(float t);
+        inline float linear(float t) {
+            return t;
+        }
+        
+        inline float sineIn(float t) {
+            return 1 - std::cos((t * 3.14159265358979323846f) / 2);
+        }
+        
+        inline float sineOut(float t) {
+            return std::sin((t * 3.14159265358979323846f) / 2);
+        }
+        
+        inline float sineInOut(float t) {
+            return -0.5f * (std::cos(3.14159265358979323846f * t) - 1);
+        }
+        
+        inline float quadIn(float t) {
+            return t * t;
+        }
+        
+        inline float quadOut(float t) {
+            return 1 - (1 - t) * (1 - t);
+        }
+        
+        inline float quadInOut(float t) {
+            float u = -2 * t + 2;
+            return t < 0.5f ? 2 * t * t : 1 - u * u / 2;
+        }
+        
+        inline float cubicIn(float t) {
+            return t * t * t;
+        }
+        
+        inline float cubicOut(float t) {
+            float u = 1 - t;
+            return 1 - u * u * u;
+        }
+        
+        inline float cubicInOut(float t) {
+            float u = -2 * t + 2;
+            return t < 0.5f ? 4 * t * t * t : 1 - u * u * u / 2;
+        }
+        
+        inline float quartIn(float t) {
+            return t * t * t * t;
+        }
+        
+        inline float quartOut(float t) {
+            float u = 1 - t;
+            return 1 - u * u * u * u;
+        }
+        
+        inline float quartInOut(float t) {
+            float u = -2 * t + 2;
+            return t < 0.5f ? 8 * t * t * t * t : 1 - u * u * u * u / 2;
+        }
+        
+        inline float quintIn(float t) {
+            return t * t * t * t * t;
+        }
+        
+        inline float quintOut(float t) {
+            float u = 1 - t;
+            return 1 - u * u * u * u * u;
+        }
+        
+        inline float quintInOut(float t) {
+            float u = -2 * t + 2;
+            return t < 0.5f ? 16 * t * t * t * t * t : 1 - u * u * u * u * u / 2;
+        }
+        
+        inline float expoIn(float t) {
+            return t == 0 ? 0 : std::exp2(10 * t - 10);
+        }
+        
+        inline float expoOut(float t) {
+            return t == 1 ? 1 : 1 - std::exp2(-10 * t);
+        }
+        
+        inline float expoInOut(float t) {
+            return t == 0 ? 0 : t == 1 ? 1 : t < 0.5f ? std::exp2(20 * t - 10) / 2 : (2 - std::exp2(-20 * t + 10)) / 2;
+        }
+        
+        inline float circIn(float t) {
+            return 1 - std::sqrt(1 - t * t);
+        }
+        
+        inline float circOut(float t) {
+            return std::sqrt(1 - (t - 1) * (t - 1));
+        }
+        
+        inline float circInOut(float t) {
+            float a = 2 * t;
+            float b = -2 * t + 2;
+            return t < 0.5f ? (1 - std::sqrt(1 - a * a)) / 2 : (std::sqrt(1 - b * b) + 1) / 2;
+        }
+        
+        inline float backIn(float t) {
+            const float c1 = 1.70158f;
+            const float c3 = c1 + 1;
+            return c3 * t * t * t - c1 * t * t;
+        }
+        
+        inline float backOut(float t) {
+            const float c1 = 1.70158f;
+            const float c3 = c1 + 1;
+            float u = t - 1;
+            return 1 + c3 * u * u * u + c1 * u * u;
+        }
+        
+        inline float backInOut(float t) {
+            const float c1 = 1.70158f;
+            const float c2 = c1 * 1.525f;
+            float a = 2 * t;
+            float b = 2 * t - 2;
+            return t < 0.5f ? (a * a * ((c2 + 1) * a - c2)) / 2 : (b * b * ((c2 + 1) * b + c2) + 2) / 2;
+        }
+        
+        inline float elasticIn(float t) {
+            const float c4 = (2 * 3.14159265358979323846f) / 3;
+            return t == 0 ? 0 : t == 1 ? 1 : -std::exp2(10 * t - 10) * std::sin((t * 10 - 10.75f) * c4);
+        }
+        
+        inline float elasticOut(float t) {
+            const float c4 = (2 * 3.14159265358979323846f) / 3;
+            return t == 0 ? 0 : t == 1 ? 1 : std::exp2(-10 * t) * std::sin((t * 10 - 0.75f) * c4) + 1;
+        }
+        
+        inline float elasticInOut(float t) {
+            const float c5 = (2 * 3.14159265358979323846f) / 4.5f;
+            return t == 0 ? 0 : t == 1 ? 1 : t < 0.5f ? -(std::exp2(20 * t - 10) * std::sin((20 * t - 11.125f) * c5)) / 2 : (std::exp2(-20 * t + 10) * std::sin((20 * t - 11.125f) * c5)) / 2 + 1;
+        }
+        
+        inline float bounceOut(float t) {
+            const float n1 = 7.5625f;
+            const float d1 = 2.75f;
+            if (t < 1.0f / d1) {
+                return n1 * t * t;
+            } else if (t < 2.0f / d1) {
+                t -= 1.5f / d1;
+                return n1 * t * t + 0.75f;
+            } else if (t < 2.5f / d1) {
+                t -= 2.25f / d1;
+                return n1 * t * t + 0.9375f;
+            } else {
+                t -= 2.625f / d1;
+                return n1 * t * t + 0.984375f;
+            }
+        }
+        
+        inline float bounceIn(float t) {
+            return 1 - bounceOut(1 - t);
+        }
+        
+        inline float bounceInOut(float t) {
+            return t < 0.5f ? (1 - bounceOut(1 - 2 * t)) / 2 : (1 + bounceOut(2 * t - 1)) / 2;
+        }
     }
     
     float ease(float t, EaseType type = EaseType::Linear);
     
+    // Easing with the curve chosen at compile time, e.g. ease<EaseType::CubicOut>(t)
+    template<EaseType Type>
+    inline float ease(float t) {
+        if constexpr (Type == EaseType::Linear) return EaseFunctions::linear(t);
+        else if constexpr (Type == EaseType::SineIn) return EaseFunctions::sineIn(t);
+        else if constexpr (Type == EaseType::SineOut) return EaseFunctions::sineOut(t);
+        else if constexpr (Type == EaseType::SineInOut) return EaseFunctions::sineInOut(t);
+        else if constexpr (Type == EaseType::QuadIn) return EaseFunctions::quadIn(t);
+        else if constexpr (Type == EaseType::QuadOut) return EaseFunctions::quadOut(t);
+        else if constexpr (Type == EaseType::QuadInOut) return EaseFunctions::quadInOut(t);
+        else if constexpr (Type == EaseType::CubicIn) return EaseFunctions::cubicIn(t);
+        else if constexpr (Type == EaseType::CubicOut) return EaseFunctions::cubicOut(t);
+        else if constexpr (Type == EaseType::CubicInOut) return EaseFunctions::cubicInOut(t);
+        else if constexpr (Type == EaseType::QuartIn) return EaseFunctions::quartIn(t);
+        else if constexpr (Type == EaseType::QuartOut) return EaseFunctions::quartOut(t);
+        else if constexpr (Type == EaseType::QuartInOut) return EaseFunctions::quartInOut(t);
+        else if constexpr (Type == EaseType::QuintIn) return EaseFunctions::quintIn(t);
+        else if constexpr (Type == EaseType::QuintOut) return EaseFunctions::quintOut(t);
+        else if constexpr (Type == EaseType::QuintInOut) return EaseFunctions::quintInOut(t);
+        else if constexpr (Type == EaseType::ExpoIn) return EaseFunctions::expoIn(t);
+        else if constexpr (Type == EaseType::ExpoOut) return EaseFunctions::expoOut(t);
+        else if constexpr (Type == EaseType::ExpoInOut) return EaseFunctions::expoInOut(t);
+        else if constexpr (Type == EaseType::CircIn) return EaseFunctions::circIn(t);
+        else if constexpr (Type == EaseType::CircOut) return EaseFunctions::circOut(t);
+        else if constexpr (Type == EaseType::CircInOut) return EaseFunctions::circInOut(t);
+        else if constexpr (Type == EaseType::BackIn) return EaseFunctions::backIn(t);
+        else if constexpr (Type == EaseType::BackOut) return EaseFunctions::backOut(t);
+        else if constexpr (Type == EaseType::BackInOut) return EaseFunctions::backInOut(t);
+        else if constexpr (Type == EaseType::ElasticIn) return EaseFunctions::elasticIn(t);
+        else if constexpr (Type == EaseType::ElasticOut) return EaseFunctions::elasticOut(t);
+        else if constexpr (Type == EaseType::ElasticInOut) return EaseFunctions::elasticInOut(t);
+        else if constexpr (Type == EaseType::BounceIn) return EaseFunctions::bounceIn(t);
+        else if constexpr (Type == EaseType::BounceOut) return EaseFunctions::bounceOut(t);
+        else return EaseFunctions::bounceInOut(t);
+    }
+    
+    // Eases every value of t into out; the curve is selected once per call
+    void easeBatch(EaseType type, std::span<const float> t, std::span<float> out);
+    
     template<typename T>
     T easeLerp(const T& a, const T& b, float t, EaseType type = EaseType::Linear);
     
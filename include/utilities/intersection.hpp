@@ -12,7 +12,10 @@
 #include "../geometry/triangle.hpp"
 #include "../geometry/obb.hpp"
 #include "../geometry/capsule.hpp"
+#include "../geometry/polygon.hpp"
 #include <cmath>
+#include <cstdint>
+#include <span>
 #include <algorithm>
 
 namespace Intersection {
@@ -67,6 +70,49 @@ namespace Intersection {
     bool sphereSphere(const Spheref& s1, const Spheref& s2);
     bool aabbAABB(const AABBf& a, const AABBf& b);
      
+    // Watertight ray-triangle test (Woop, Benthin, Wald 2013). Rays through a
+    // shared edge or vertex always hit at least one of the adjacent triangles.
+    struct WatertightRay {
+        Vector3f origin;
+        int kx, ky, kz;         // Permuted axes, kz is the dominant direction
+        float sx, sy, sz;       // Shear constants
+    };
+    
+    WatertightRay prepareWatertightRay(const Ray<float>& ray);
+    bool rayTriangleWatertight(const WatertightRay& ray, const Vector3f& v0,
+                               const Vector3f& v1, const Vector3f& v2,
+                               float& t, Vector3f* barycentric = nullptr);
+    bool rayTriangleWatertight(const Ray<float>& ray, const Vector3f& v0,
+                               const Vector3f& v1, const Vector3f& v2,
+                               float& t, Vector3f* barycentric = nullptr,
+                               Vector3f* normal = nullptr);
+    
+    // Triangle with its unit normal stored for repeated ray tests. The ray tests
+    // are watertight, so the vertices are kept exactly as given: triangles
+    // sharing an edge must see bit-identical endpoints.
+    struct PrecomputedTriangle {
+        Vector3f v0;
+        Vector3f v1;
+        Vector3f v2;
+        Vector3f normal;
+        
+        static PrecomputedTriangle from(const Vector3f& v0, const Vector3f& v1, const Vector3f& v2);
+        static PrecomputedTriangle from(const Trianglef& triangle);
+    };
+    
+    bool rayTriangle(const Ray<float>& ray, const PrecomputedTriangle& triangle,
+                     float& t, Vector3f* barycentric = nullptr,
+                     Vector3f* normal = nullptr);
+    
+    // Any-hit queries for shadow rays: only report whether something lies in (0, tMax)
+    bool rayTriangleOccluded(const Ray<float>& ray, const Vector3f& v0,
+                             const Vector3f& v1, const Vector3f& v2, float tMax);
+    bool rayTriangleOccluded(const Ray<float>& ray, const PrecomputedTriangle& triangle, float tMax);
+    bool rayTriangleOccluded(const WatertightRay& ray, const PrecomputedTriangle& triangle, float tMax);
+    // Prepares the ray once and tests the triangles in order
+    bool rayTrianglesOccluded(const Ray<float>& ray, std::span<const PrecomputedTriangle> triangles,
+                              float tMax);
+     
     // Frustum intersections (for camera)
     struct Frustum {
         Plane<float> planes[6]; // left, right, top, bottom, near, far
@@ -79,10 +125,23 @@ namespace Intersection {
     // 3D volume intersections
     bool aabbTriangle(const AABBf& aabb, const Vector3f& v0,
                       const Vector3f& v1, const Vector3f& v2);
+    bool aabbTriangle(const Vector3f& center, const Vector3f& extents,
+                      const Vector3f& v0, const Vector3f& v1, const Vector3f& v2);
      
     // SAT (Separating Axis Theorem) for convex polygons
     bool satTest2D(const std::vector<Vector2f>& poly1,
                    const std::vector<Vector2f>& poly2);
+    bool satTest2D(const ConvexPolygon2Df& poly1, const ConvexPolygon2Df& poly2,
+                   Vector2f* mtv = nullptr);
+    
+    // Tests one polygon against many; writes the indices of overlapping polygons
+    // (and their MTVs, if a buffer is given) in order and returns the total number
+    // of hits. Only the first min(hitIndices.size(), mtvs.size()) hits are written,
+    // so a return value above that capacity means the output was truncated.
+    size_t satTest2DBatch(const ConvexPolygon2Df& poly,
+                          std::span<const ConvexPolygon2Df> others,
+                          std::span<uint32_t> hitIndices,
+                          std::span<Vector2f> mtvs = {});
      
     // Intersection point calculation
     Vector3f computeIntersectionPoint(const Ray<float>& ray, float t);
@@ -94,6 +153,24 @@ namespace Intersection {
     float distancePointToPlane(const Vector3f& point,
                                const Vector3f& planePoint,
                                const Vector3f& planeNormal);
+    
+    // Closest points on primitives
+    Vector3f closestPointSegment(const Vector3f& point, const Vector3f& a, const Vector3f& b);
+    Vector3f closestPointAABB(const Vector3f& point, const AABBf& aabb);
+    Vector3f closestPointOBB(const Vector3f& point, const OBBf& obb);
+    Vector3f closestPointTriangle(const Vector3f& point, const Vector3f& v0,
+                                  const Vector3f& v1, const Vector3f& v2);
+    float distancePointToTriangle(const Vector3f& point, const Vector3f& v0,
+                                  const Vector3f& v1, const Vector3f& v2);
+    float distancePointToOBB(const Vector3f& point, const OBBf& obb);
+    
+    // Closest points between primitives; both return the squared distance
+    float closestPointsSegmentSegment(const Vector3f& p1, const Vector3f& q1,
+                                      const Vector3f& p2, const Vector3f& q2,
+                                      Vector3f& c1, Vector3f& c2);
+    float closestPointsSegmentTriangle(const Vector3f& p, const Vector3f& q,
+                                       const Vector3f& v0, const Vector3f& v1, const Vector3f& v2,
+                                       Vector3f& onSegment, Vector3f& onTriangle);
      
     // Point classification relative to plane
     enum class PlaneSide {
@@ -0,0 +1,65 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+    // Worker count used when callers pass threadCount = 0
+    size_t defaultThreadCount();
+    
+    // Number of workers forRange will use for a given amount of work
+    size_t workerCount(size_t count, size_t threadCount = 0, size_t minPerWorker = 1);
+    
+    // Splits [0, count) into contiguous ranges and calls fn(begin, end, worker)
+    // for each one. The calling thread processes the last range itself.
+    // An exception thrown by fn is rethrown on the caller once every range
+    // has finished; if several ranges throw, the first range's wins.
+    template<typename Fn>
+    void forRange(size_t count, size_t threadCount, size_t minPerWorker, Fn&& fn) {
+        size_t workers = workerCount(count, threadCount, minPerWorker);
+        if (workers <= 1) {
+            if (count > 0) {
+                fn(size_t(0), count, size_t(0));
+            }
+            return;
+        }
+        
+        // Rounding the chunk up can leave trailing workers with nothing to do
+        size_t chunk = (count + workers - 1) / workers;
+        workers = (count + chunk - 1) / chunk;
+        std::vector<std::exception_ptr> errors(workers);
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (size_t w = 0; w + 1 < workers; ++w) {
+            size_t begin = w * chunk;
+            size_t end = std::min(count, begin + chunk);
+            threads.emplace_back([&fn, &errors, begin, end, w]() {
+                try {
+                    fn(begin, end, w);
+                } catch (...) {
+                    errors[w] = std::current_exception();
+                }
+            });
+        }
+        
+        size_t last = (workers - 1) * chunk;
+        if (last < count) {
+            try {
+                fn(last, count, workers - 1);
+            } catch (...) {
+                errors[workers - 1] = std::current_exception();
+            }
+        }
+        
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
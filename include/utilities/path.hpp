@@ -0,0 +1,67 @@
+#pragma once
+#include <span>
+#include <vector>
+#include "../vectors/vector2.hpp"
+#include "../vectors/vector3.hpp"
+
+// Curve through a list of points with a precomputed arc-length table, so it
+// can be sampled at constant speed. Each segment is split into subdivisions
+// chords whose cumulative lengths are stored; a distance is turned back into
+// a curve parameter by binary search, or through an optional uniform table
+// that makes the lookup O(1).
+//
+// Linear and CatmullRom segments join consecutive points (the end points are
+// repeated for the outer Catmull-Rom tangents). Bezier expects cubic control
+// points laid out as p0, c0, c1, p1, c2, c3, p2, ... i.e. 3n + 1 points.
+template<typename T>
+class Path {
+public:
+    enum class SegmentType {
+        Linear,
+        CatmullRom,
+        Bezier
+    };
+
+    static constexpr size_t DEFAULT_SUBDIVISIONS = 16;
+
+    Path();
+    explicit Path(std::span<const T> points, SegmentType type = SegmentType::Linear,
+                  size_t subdivisions = DEFAULT_SUBDIVISIONS);
+
+    void build(std::span<const T> points, SegmentType type = SegmentType::Linear,
+               size_t subdivisions = DEFAULT_SUBDIVISIONS);
+
+    // Resamples the distance-to-parameter mapping at size evenly spaced
+    // distances; later samples interpolate this table instead of searching
+    void buildUniformTable(size_t size = 256);
+    bool hasUniformTable() const;
+
+    // Curve parameter u in [0, segmentCount()], not arc-length parameterized
+    T evaluate(float u) const;
+
+    // Curve parameter at the given distance from the start (clamped)
+    float parameterAtDistance(float distance) const;
+    T sampleAtDistance(float distance) const;
+
+    // Constant-speed sample: t in [0, 1] is the fraction of the total length
+    T sample(float t) const;
+    // Batch sampling; increasing t values reuse the previous search position
+    void sample(std::span<const float> t, std::span<T> out) const;
+
+    float length() const;
+    size_t segmentCount() const;
+    SegmentType getSegmentType() const;
+    const std::vector<T>& getPoints() const;
+
+private:
+    std::vector<T> points;
+    std::vector<float> distances;   // Cumulative length at each chord end, starting at 0
+    std::vector<float> uniform;     // Curve parameter at evenly spaced distances
+    SegmentType type;
+    size_t subdivisions;
+
+    float parameterFromChord(size_t chord, float distance) const;
+};
+
+using Path2f = Path<Vector2f>;
+using Path3f = Path<Vector3f>;
@@ -0,0 +1,46 @@
+#pragma once
+#include <span>
+#include <vector>
+#include "../vectors/vector2.hpp"
+#include "../vectors/vector3.hpp"
+
+// Polyline simplification. Both methods keep the first and last points and
+// write the kept points, in order, to out.
+namespace Polyline {
+    // Ramer-Douglas-Peucker: every removed point lies within tolerance of the
+    // simplified polyline. Iterative, so very long tracks cannot overflow the stack.
+    template<typename T>
+    void simplifyRDP(std::span<const T> points, float tolerance, std::vector<T>& out);
+
+    // Visvalingam-Whyatt: repeatedly removes the point whose triangle with
+    // its neighbours has the smallest area, until that area reaches minArea
+    // or only minPoints remain
+    template<typename T>
+    void simplifyVisvalingam(std::span<const T> points, float minArea, std::vector<T>& out,
+                             size_t minPoints = 2);
+}
+
+// Resamples a polyline fed one point at a time into points spaced evenly
+// along its length. Only the previous input point is kept, so arbitrarily
+// long streams use constant memory. The first input point is always emitted;
+// finish() emits the final point when it does not fall on the spacing.
+template<typename T>
+class StreamingResampler {
+public:
+    explicit StreamingResampler(float spacing);
+
+    // Appends the samples reached by the new point to out; returns how many
+    size_t push(const T& point, std::vector<T>& out);
+    size_t finish(std::vector<T>& out);
+    void reset();
+
+    float getSpacing() const;
+    float distanceTravelled() const;
+
+private:
+    float spacing;
+    float carried;      // Distance from the last sample to the last input point
+    float travelled;
+    T last;
+    bool started;
+};
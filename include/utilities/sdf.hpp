@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../vectors/vector3.hpp"
+#include "../geometry/aabb.hpp"
+#include "../geometry/ray.hpp"
+
+// Signed distance field sampled on a regular grid of nodes.
+// Distances are negative inside the mesh; sampling is trilinear.
+class SignedDistanceField {
+public:
+    SignedDistanceField();
+    SignedDistanceField(const AABBf& bounds, float cellSize);
+
+    // Bakes an indexed triangle mesh. Exact distances are computed in a narrow
+    // band of bandCells around each triangle, then propagated by fast sweeping.
+    // The sign comes from interior parity, so the mesh should be closed.
+    static SignedDistanceField bake(std::span<const Vector3f> vertices,
+                                    std::span<const uint32_t> indices,
+                                    float cellSize, float padding = 0.0f,
+                                    int bandCells = 2, size_t threadCount = 0);
+
+    const AABBf& getBounds() const;
+    float getCellSize() const;
+    Vector3i getResolution() const; // Node counts per axis
+
+    float get(int x, int y, int z) const;
+    void set(int x, int y, int z, float value);
+    Vector3f nodePosition(int x, int y, int z) const;
+
+    // Queries (positions outside the grid are clamped to it)
+    float sample(const Vector3f& point) const;
+    Vector3f gradient(const Vector3f& point) const;
+    Vector3f normal(const Vector3f& point) const;
+    void sample(std::span<const Vector3f> points, std::span<float> distances) const;
+
+    // Sphere tracing against the zero level set
+    bool sphereTrace(const Ray<float>& ray, float maxDistance, float& t,
+                     int maxSteps = 128, float epsilon = 1e-3f) const;
+
+private:
+    AABBf bounds;
+    float cellSize;
+    Vector3i resolution;
+    std::vector<float> values;
+
+    size_t index(int x, int y, int z) const;
+    void locate(const Vector3f& point, int& x, int& y, int& z, Vector3f& t) const;
+};
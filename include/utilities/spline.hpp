@@ -0,0 +1,69 @@
+#pragma once
+#include <span>
+#include <vector>
+#include "../vectors/vector2.hpp"
+#include "../vectors/vector3.hpp"
+
+// Piecewise cubic curve stored as per-segment polynomial coefficients,
+// p(t) = a + b t + c t^2 + d t^3 with t in [0, 1]. The curve parameter u runs
+// over [0, segmentCount()], segment i covering [i, i + 1]. CatmullRomSpline,
+// CubicBezierSpline and BSpline below only differ in how they build the
+// coefficients; each of them and this base are instantiated for Vector2f and
+// Vector3f.
+template<typename T>
+class CubicSpline {
+public:
+    struct Segment {
+        T a, b, c, d;
+    };
+
+    size_t segmentCount() const;
+    const std::vector<Segment>& getSegments() const;
+
+    T evaluate(float u) const;
+    T derivative(float u) const;
+    T secondDerivative(float u) const;
+    T tangent(float u) const;       // Unit-length derivative
+
+    void evaluate(std::span<const float> u, std::span<T> out) const;
+    void derivative(std::span<const float> u, std::span<T> out) const;
+
+    // Polyline through the curve whose interior points lie within tolerance
+    // of each chord. Segments are split recursively up to maxDepth times.
+    void flatten(float tolerance, std::vector<T>& out, int maxDepth = 16) const;
+
+protected:
+    std::vector<Segment> segments;
+};
+
+// Uniform Catmull-Rom spline through every point; the end points are
+// repeated for the outer tangents
+template<typename T>
+class CatmullRomSpline : public CubicSpline<T> {
+public:
+    CatmullRomSpline();
+    explicit CatmullRomSpline(std::span<const T> points);
+
+    void build(std::span<const T> points);
+};
+
+// Cubic Bezier segments from control points p0, c0, c1, p1, c2, c3, p2, ...
+template<typename T>
+class CubicBezierSpline : public CubicSpline<T> {
+public:
+    CubicBezierSpline();
+    explicit CubicBezierSpline(std::span<const T> controlPoints);
+
+    void build(std::span<const T> controlPoints);
+};
+
+// Uniform cubic B-spline. With clampEnds the first and last control points
+// are repeated so the curve starts and ends on them.
+template<typename T>
+class BSpline : public CubicSpline<T> {
+public:
+    BSpline();
+    explicit BSpline(std::span<const T> controlPoints, bool clampEnds = false);
+
+    void build(std::span<const T> controlPoints, bool clampEnds = false);
+};
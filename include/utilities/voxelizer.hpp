@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include "../vectors/vector3.hpp"
+#include "../geometry/aabb.hpp"
+
+// Dense voxel occupancy grid, one bit per cell
+class VoxelGrid {
+public:
+    VoxelGrid();
+    VoxelGrid(const AABBf& bounds, float voxelSize);
+
+    const AABBf& getBounds() const;
+    float getVoxelSize() const;
+    Vector3i getResolution() const;
+
+    bool get(int x, int y, int z) const;
+    void set(int x, int y, int z, bool value = true);
+    void setAtomic(int x, int y, int z); // Safe to call from several threads
+
+    bool inBounds(int x, int y, int z) const;
+    Vector3i worldToVoxel(const Vector3f& point) const;
+    Vector3f voxelCenter(int x, int y, int z) const;
+    AABBf voxelBounds(int x, int y, int z) const;
+
+    size_t countFilled() const;
+    void clear();
+
+private:
+    AABBf bounds;
+    float voxelSize;
+    Vector3i resolution;
+    std::vector<uint64_t> words;
+
+    size_t index(int x, int y, int z) const;
+};
+
+// Sparse voxel grid made of 8x8x8 bricks allocated on demand
+class SparseVoxelGrid {
+public:
+    static constexpr int BRICK_SIZE = 8;
+    using Brick = std::array<uint64_t, BRICK_SIZE>; // One 64-bit word per z slice
+
+    SparseVoxelGrid();
+    SparseVoxelGrid(const Vector3f& origin, float voxelSize);
+
+    const Vector3f& getOrigin() const;
+    float getVoxelSize() const;
+
+    bool get(int x, int y, int z) const;
+    void set(int x, int y, int z, bool value = true);
+
+    Vector3i worldToVoxel(const Vector3f& point) const;
+    Vector3f voxelCenter(int x, int y, int z) const;
+
+    size_t brickCount() const;
+    size_t countFilled() const;
+    void merge(const SparseVoxelGrid& other); // Union with a grid of the same layout
+    void clear();
+
+    const std::unordered_map<uint64_t, Brick>& getBricks() const;
+
+private:
+    Vector3f origin;
+    float voxelSize;
+    std::unordered_map<uint64_t, Brick> bricks;
+
+    static uint64_t brickKey(int bx, int by, int bz);
+};
+
+// Triangle mesh rasterization into voxel grids.
+// Meshes are indexed triangle lists; solid fill expects closed meshes.
+namespace Voxelizer {
+    enum class FillMode {
+        Surface,    // Voxels touched by a triangle
+        Solid,      // Surface plus interior (parity along +Z columns)
+        Interior    // Only voxels whose centers lie inside the mesh
+    };
+
+    AABBf meshBounds(std::span<const Vector3f> vertices);
+
+    // Dense grid sized to the mesh bounds padded by one voxel
+    VoxelGrid voxelize(std::span<const Vector3f> vertices,
+                       std::span<const uint32_t> indices,
+                       float voxelSize, FillMode mode = FillMode::Surface,
+                       size_t threadCount = 0);
+
+    // Rasterizes into an existing dense grid (cells are only ever set)
+    void voxelize(VoxelGrid& grid, std::span<const Vector3f> vertices,
+                  std::span<const uint32_t> indices,
+                  FillMode mode = FillMode::Surface, size_t threadCount = 0);
+
+    SparseVoxelGrid voxelizeSparse(std::span<const Vector3f> vertices,
+                                   std::span<const uint32_t> indices,
+                                   float voxelSize, FillMode mode = FillMode::Surface,
+                                   size_t threadCount = 0);
+}
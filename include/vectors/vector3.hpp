@@ -11,6 +11,7 @@ struct Vector3 {
     Vector3 operator-(const Vector3& other) const;
     Vector3 operator-() const;
     Vector3 operator*(T scalar) const;
+    Vector3 operator*(const Vector3& other) const; // Component-wise
     Vector3 operator/(T scalar) const;
     
     Vector3 cross(const Vector3& other) const;
@@ -0,0 +1,237 @@
+#include "../../include/animation/clip.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    // Keys scanned forward from the cursor before falling back to a binary search
+    constexpr uint32_t MAX_SCAN = 4;
+
+    // Index of the key segment [i, i + 1] containing time, clamped to the
+    // channel; needs at least two keys
+    uint32_t seek(const std::vector<float>& times, float time, uint32_t cursor) {
+        const uint32_t last = static_cast<uint32_t>(times.size()) - 2;
+        if (cursor <= last && times[cursor] <= time) {
+            for (uint32_t step = 0; step < MAX_SCAN; ++step) {
+                if (cursor == last || times[cursor + 1] > time) {
+                    return cursor;
+                }
+                ++cursor;
+            }
+        }
+        size_t upper = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin());
+        return static_cast<uint32_t>(std::min<size_t>(upper == 0 ? 0 : upper - 1, last));
+    }
+
+    float segmentFactor(const std::vector<float>& times, uint32_t i, float time) {
+        float span = times[i + 1] - times[i];
+        return span > 0.0f ? std::clamp((time - times[i]) / span, 0.0f, 1.0f) : 0.0f;
+    }
+
+    void checkOrder(const std::vector<float>& times, float time) {
+        if (!times.empty() && time < times.back()) {
+            throw std::invalid_argument("Keys must be added in increasing time order");
+        }
+    }
+}
+
+// Track
+
+AnimationTrack::AnimationTrack(uint32_t bone) : bone(bone) {}
+
+uint32_t AnimationTrack::getBone() const {
+    return bone;
+}
+
+void AnimationTrack::setBone(uint32_t bone) {
+    this->bone = bone;
+}
+
+void AnimationTrack::addPositionKey(float time, const Vector3f& position) {
+    checkOrder(positionTimes, time);
+    positionTimes.push_back(time);
+    positionValues.push_back(position);
+}
+
+void AnimationTrack::addRotationKey(float time, const Quaternion<float>& rotation) {
+    checkOrder(rotationTimes, time);
+    rotationTimes.push_back(time);
+    rotationValues.push_back(rotation);
+}
+
+void AnimationTrack::addScaleKey(float time, const Vector3f& scale) {
+    checkOrder(scaleTimes, time);
+    scaleTimes.push_back(time);
+    scaleValues.push_back(scale);
+}
+
+void AnimationTrack::reserve(size_t positionKeys, size_t rotationKeys, size_t scaleKeys) {
+    positionTimes.reserve(positionKeys);
+    positionValues.reserve(positionKeys);
+    rotationTimes.reserve(rotationKeys);
+    rotationValues.reserve(rotationKeys);
+    scaleTimes.reserve(scaleKeys);
+    scaleValues.reserve(scaleKeys);
+}
+
+void AnimationTrack::clear() {
+    positionTimes.clear();
+    positionValues.clear();
+    rotationTimes.clear();
+    rotationValues.clear();
+    scaleTimes.clear();
+    scaleValues.clear();
+}
+
+const std::vector<float>& AnimationTrack::getPositionTimes() const {
+    return positionTimes;
+}
+
+const std::vector<Vector3f>& AnimationTrack::getPositionValues() const {
+    return positionValues;
+}
+
+const std::vector<float>& AnimationTrack::getRotationTimes() const {
+    return rotationTimes;
+}
+
+const std::vector<Quaternion<float>>& AnimationTrack::getRotationValues() const {
+    return rotationValues;
+}
+
+const std::vector<float>& AnimationTrack::getScaleTimes() const {
+    return scaleTimes;
+}
+
+const std::vector<Vector3f>& AnimationTrack::getScaleValues() const {
+    return scaleValues;
+}
+
+float AnimationTrack::startTime() const {
+    float start = std::numeric_limits<float>::max();
+    if (!positionTimes.empty()) start = std::min(start, positionTimes.front());
+    if (!rotationTimes.empty()) start = std::min(start, rotationTimes.front());
+    if (!scaleTimes.empty()) start = std::min(start, scaleTimes.front());
+    return start == std::numeric_limits<float>::max() ? 0.0f : start;
+}
+
+float AnimationTrack::endTime() const {
+    float end = std::numeric_limits<float>::lowest();
+    if (!positionTimes.empty()) end = std::max(end, positionTimes.back());
+    if (!rotationTimes.empty()) end = std::max(end, rotationTimes.back());
+    if (!scaleTimes.empty()) end = std::max(end, scaleTimes.back());
+    return end == std::numeric_limits<float>::lowest() ? 0.0f : end;
+}
+
+void AnimationTrack::sample(float time, Transform<float>& out, Cursor& cursor) const {
+    if (positionTimes.size() > 1) {
+        cursor.position = seek(positionTimes, time, cursor.position);
+        float t = segmentFactor(positionTimes, cursor.position, time);
+        const Vector3f& a = positionValues[cursor.position];
+        const Vector3f& b = positionValues[cursor.position + 1];
+        out.setPosition(a + (b - a) * t);
+    } else if (!positionTimes.empty()) {
+        out.setPosition(positionValues[0]);
+    }
+
+    if (rotationTimes.size() > 1) {
+        cursor.rotation = seek(rotationTimes, time, cursor.rotation);
+        float t = segmentFactor(rotationTimes, cursor.rotation, time);
+        out.setRotation(Quaternion<float>::slerp(rotationValues[cursor.rotation], rotationValues[cursor.rotation + 1], t));
+    } else if (!rotationTimes.empty()) {
+        out.setRotation(rotationValues[0]);
+    }
+
+    if (scaleTimes.size() > 1) {
+        cursor.scale = seek(scaleTimes, time, cursor.scale);
+        float t = segmentFactor(scaleTimes, cursor.scale, time);
+        const Vector3f& a = scaleValues[cursor.scale];
+        const Vector3f& b = scaleValues[cursor.scale + 1];
+        out.setScale(a + (b - a) * t);
+    } else if (!scaleTimes.empty()) {
+        out.setScale(scaleValues[0]);
+    }
+}
+
+void AnimationTrack::sample(float time, Transform<float>& out) const {
+    Cursor cursor;
+    sample(time, out, cursor);
+}
+
+// Clip
+
+AnimationClip::AnimationClip() {}
+
+size_t AnimationClip::addTrack(const AnimationTrack& track) {
+    tracks.push_back(track);
+    return tracks.size() - 1;
+}
+
+size_t AnimationClip::addTrack(AnimationTrack&& track) {
+    tracks.push_back(std::move(track));
+    return tracks.size() - 1;
+}
+
+const AnimationTrack& AnimationClip::getTrack(size_t index) const {
+    return tracks[index];
+}
+
+AnimationTrack& AnimationClip::getTrack(size_t index) {
+    return tracks[index];
+}
+
+size_t AnimationClip::trackCount() const {
+    return tracks.size();
+}
+
+void AnimationClip::clear() {
+    tracks.clear();
+}
+
+float AnimationClip::startTime() const {
+    if (tracks.empty()) {
+        return 0.0f;
+    }
+    float start = tracks[0].startTime();
+    for (const AnimationTrack& track : tracks) {
+        start = std::min(start, track.startTime());
+    }
+    return start;
+}
+
+float AnimationClip::endTime() const {
+    if (tracks.empty()) {
+        return 0.0f;
+    }
+    float end = tracks[0].endTime();
+    for (const AnimationTrack& track : tracks) {
+        end = std::max(end, track.endTime());
+    }
+    return end;
+}
+
+float AnimationClip::duration() const {
+    return endTime() - startTime();
+}
+
+void AnimationClip::sample(float time, std::span<Transform<float>> pose, std::span<AnimationTrack::Cursor> cursors) const {
+    if (cursors.size() < tracks.size()) {
+        throw std::invalid_argument("Need one cursor per track");
+    }
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        uint32_t bone = tracks[i].getBone();
+        if (bone < pose.size()) {
+            tracks[i].sample(time, pose[bone], cursors[i]);
+        }
+    }
+}
+
+void AnimationClip::sample(float time, std::span<Transform<float>> pose) const {
+    for (const AnimationTrack& track : tracks) {
+        uint32_t bone = track.getBone();
+        if (bone < pose.size()) {
+            track.sample(time, pose[bone]);
+        }
+    }
+}
@@ -0,0 +1,334 @@
+#include "../../include/animation/compressed.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr float MAX_TICK = 65535.0f;
+    constexpr float MAX_FRACTION = 65535.0f;
+    constexpr float MAX_COMPONENT = 32767.0f;
+    constexpr float SQRT2 = 1.41421356237309504880f;
+    constexpr uint32_t MAX_SCAN = 4;
+
+    // Greedy error-bounded reduction: a key is dropped while interpolating
+    // between the last kept key and a later one still reproduces every key in
+    // between. fits(a, b, k) tests key k against the segment [a, b].
+    template<typename Fits>
+    std::vector<uint32_t> reduceKeys(uint32_t count, Fits&& fits) {
+        std::vector<uint32_t> kept;
+        if (count == 0) {
+            return kept;
+        }
+        kept.push_back(0);
+        uint32_t anchor = 0;
+        for (uint32_t candidate = 2; candidate < count; ++candidate) {
+            for (uint32_t k = anchor + 1; k < candidate; ++k) {
+                if (!fits(anchor, candidate, k)) {
+                    anchor = candidate - 1;
+                    kept.push_back(anchor);
+                    break;
+                }
+            }
+        }
+        if (count > 1) {
+            kept.push_back(count - 1);
+        }
+        return kept;
+    }
+
+    uint16_t quantizeFraction(float value, float min, float extent) {
+        if (extent <= 0.0f) {
+            return 0;
+        }
+        return static_cast<uint16_t>(std::clamp(std::round((value - min) / extent * MAX_FRACTION), 0.0f, MAX_FRACTION));
+    }
+
+    // Segment of a channel's tick array containing tick, clamped; needs two keys
+    uint32_t seek(const uint16_t* ticks, uint32_t count, float tick, uint32_t cursor) {
+        const uint32_t last = count - 2;
+        if (cursor <= last && ticks[cursor] <= tick) {
+            for (uint32_t step = 0; step < MAX_SCAN; ++step) {
+                if (cursor == last || ticks[cursor + 1] > tick) {
+                    return cursor;
+                }
+                ++cursor;
+            }
+        }
+        uint32_t upper = static_cast<uint32_t>(std::upper_bound(ticks, ticks + count, tick) - ticks);
+        return std::min(upper == 0 ? 0 : upper - 1, last);
+    }
+
+    float segmentFactor(const uint16_t* ticks, uint32_t i, float tick) {
+        float span = static_cast<float>(ticks[i + 1]) - static_cast<float>(ticks[i]);
+        return span > 0.0f ? std::clamp((tick - ticks[i]) / span, 0.0f, 1.0f) : 0.0f;
+    }
+}
+
+// Constructors
+
+CompressedClip::CompressedClip() : start(0.0f), end(0.0f), tickDuration(1.0f) {}
+
+// Quaternion codec
+
+void CompressedClip::packQuaternion(const Quaternion<float>& rotation, uint16_t out[3]) {
+    Quaternion<float> q = rotation.normalized();
+    const float components[4] = { q.getW(), q.getX(), q.getY(), q.getZ() };
+
+    int largest = 0;
+    for (int i = 1; i < 4; ++i) {
+        if (std::abs(components[i]) > std::abs(components[largest])) {
+            largest = i;
+        }
+    }
+
+    // q and -q are the same rotation, so the dropped component is made positive
+    float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    uint16_t packed[3];
+    for (int i = 0, j = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        float normalized = (components[i] * sign * SQRT2 + 1.0f) * 0.5f;
+        packed[j++] = static_cast<uint16_t>(std::clamp(std::round(normalized * MAX_COMPONENT), 0.0f, MAX_COMPONENT));
+    }
+
+    out[0] = static_cast<uint16_t>(packed[0] | ((largest >> 1) << 15));
+    out[1] = static_cast<uint16_t>(packed[1] | ((largest & 1) << 15));
+    out[2] = packed[2];
+}
+
+Quaternion<float> CompressedClip::unpackQuaternion(const uint16_t in[3]) {
+    const int largest = ((in[0] >> 15) << 1) | (in[1] >> 15);
+    float small[3];
+    float sumSquares = 0.0f;
+    for (int j = 0; j < 3; ++j) {
+        small[j] = ((in[j] & 0x7FFF) / MAX_COMPONENT * 2.0f - 1.0f) / SQRT2;
+        sumSquares += small[j] * small[j];
+    }
+
+    float components[4];
+    for (int i = 0, j = 0; i < 4; ++i) {
+        components[i] = i == largest ? std::sqrt(std::max(0.0f, 1.0f - sumSquares)) : small[j++];
+    }
+    return Quaternion<float>(components[0], components[1], components[2], components[3]);
+}
+
+// Compression
+
+CompressedClip CompressedClip::compress(const AnimationClip& clip) {
+    return compress(clip, Settings());
+}
+
+CompressedClip CompressedClip::compress(const AnimationClip& clip, const Settings& settings) {
+    CompressedClip result;
+    result.start = clip.startTime();
+    result.end = clip.endTime();
+    result.tickDuration = clip.duration() > 0.0f ? clip.duration() / MAX_TICK : 1.0f;
+    result.tracks.reserve(clip.trackCount());
+
+    auto exactTick = [&](float time) {
+        return (time - result.start) / result.tickDuration;
+    };
+    auto quantizeTick = [&](float time) {
+        return static_cast<uint16_t>(std::clamp(std::round(exactTick(time)), 0.0f, MAX_TICK));
+    };
+
+    // Positions and scales: quantize every key, then drop keys whose decoded
+    // neighbours interpolate to within tolerance of the original value
+    auto encodeVectors = [&](const std::vector<float>& keyTimes, const std::vector<Vector3f>& keyValues,
+                             float tolerance, Channel& channel) {
+        const uint32_t count = static_cast<uint32_t>(keyTimes.size());
+        channel.first = static_cast<uint32_t>(result.times.size());
+        if (count == 0) {
+            return;
+        }
+
+        Vector3f max = keyValues[0];
+        channel.min = keyValues[0];
+        for (const Vector3f& v : keyValues) {
+            channel.min = Vector3f(std::min(channel.min.x, v.x), std::min(channel.min.y, v.y), std::min(channel.min.z, v.z));
+            max = Vector3f(std::max(max.x, v.x), std::max(max.y, v.y), std::max(max.z, v.z));
+        }
+        channel.extent = max - channel.min;
+
+        std::vector<uint16_t> ticks(count);
+        std::vector<uint16_t> quantized(static_cast<size_t>(count) * 3);
+        std::vector<Vector3f> decoded(count);
+        for (uint32_t k = 0; k < count; ++k) {
+            ticks[k] = quantizeTick(keyTimes[k]);
+            uint16_t* q = &quantized[k * 3];
+            q[0] = quantizeFraction(keyValues[k].x, channel.min.x, channel.extent.x);
+            q[1] = quantizeFraction(keyValues[k].y, channel.min.y, channel.extent.y);
+            q[2] = quantizeFraction(keyValues[k].z, channel.min.z, channel.extent.z);
+            decoded[k] = channel.min + Vector3f(q[0], q[1], q[2]) * (1.0f / MAX_FRACTION) * channel.extent;
+        }
+
+        const float toleranceSquared = tolerance * tolerance;
+        std::vector<uint32_t> kept = reduceKeys(count, [&](uint32_t a, uint32_t b, uint32_t k) {
+            float span = static_cast<float>(ticks[b]) - static_cast<float>(ticks[a]);
+            float t = span > 0.0f ? std::clamp((exactTick(keyTimes[k]) - ticks[a]) / span, 0.0f, 1.0f) : 0.0f;
+            Vector3f delta = decoded[a] + (decoded[b] - decoded[a]) * t - keyValues[k];
+            return delta.dot(delta) <= toleranceSquared;
+        });
+        if (kept.size() == 2 && std::equal(&quantized[0], &quantized[3], &quantized[kept[1] * 3])) {
+            kept.pop_back();
+        }
+
+        for (uint32_t k : kept) {
+            result.times.push_back(ticks[k]);
+            result.values.insert(result.values.end(), &quantized[k * 3], &quantized[k * 3] + 3);
+        }
+        channel.count = static_cast<uint32_t>(kept.size());
+    };
+
+    auto encodeRotations = [&](const std::vector<float>& keyTimes, const std::vector<Quaternion<float>>& keyValues,
+                               float tolerance, Channel& channel) {
+        const uint32_t count = static_cast<uint32_t>(keyTimes.size());
+        channel.first = static_cast<uint32_t>(result.times.size());
+        if (count == 0) {
+            return;
+        }
+
+        std::vector<uint16_t> ticks(count);
+        std::vector<uint16_t> quantized(static_cast<size_t>(count) * 3);
+        std::vector<Quaternion<float>> original(count);
+        std::vector<Quaternion<float>> decoded(count);
+        for (uint32_t k = 0; k < count; ++k) {
+            ticks[k] = quantizeTick(keyTimes[k]);
+            original[k] = keyValues[k].normalized();
+            packQuaternion(original[k], &quantized[k * 3]);
+            decoded[k] = unpackQuaternion(&quantized[k * 3]);
+        }
+
+        // Rotations differ by angle 4 * asin(|q - p| / 2) for unit q, p in the
+        // same hemisphere; the chord stays accurate in float where acos(dot) does not
+        const float maxChord = 2.0f * std::sin(tolerance * 0.25f);
+        const float maxChordSquared = maxChord * maxChord;
+        std::vector<uint32_t> kept = reduceKeys(count, [&](uint32_t a, uint32_t b, uint32_t k) {
+            float span = static_cast<float>(ticks[b]) - static_cast<float>(ticks[a]);
+            float t = span > 0.0f ? std::clamp((exactTick(keyTimes[k]) - ticks[a]) / span, 0.0f, 1.0f) : 0.0f;
+            Quaternion<float> q = Quaternion<float>::slerp(decoded[a], decoded[b], t);
+            if (q.dot(original[k]) < 0.0f) {
+                q = q * -1.0f;
+            }
+            Quaternion<float> delta = q + original[k] * -1.0f;
+            return delta.dot(delta) <= maxChordSquared;
+        });
+        if (kept.size() == 2 && std::equal(&quantized[0], &quantized[3], &quantized[kept[1] * 3])) {
+            kept.pop_back();
+        }
+
+        for (uint32_t k : kept) {
+            result.times.push_back(ticks[k]);
+            result.values.insert(result.values.end(), &quantized[k * 3], &quantized[k * 3] + 3);
+        }
+        channel.count = static_cast<uint32_t>(kept.size());
+    };
+
+    for (size_t i = 0; i < clip.trackCount(); ++i) {
+        const AnimationTrack& source = clip.getTrack(i);
+        Track track;
+        track.bone = source.getBone();
+        encodeVectors(source.getPositionTimes(), source.getPositionValues(), settings.positionTolerance, track.position);
+        encodeRotations(source.getRotationTimes(), source.getRotationValues(), settings.rotationTolerance, track.rotation);
+        encodeVectors(source.getScaleTimes(), source.getScaleValues(), settings.scaleTolerance, track.scale);
+        result.tracks.push_back(track);
+    }
+
+    result.times.shrink_to_fit();
+    result.values.shrink_to_fit();
+    return result;
+}
+
+// Properties
+
+size_t CompressedClip::trackCount() const {
+    return tracks.size();
+}
+
+size_t CompressedClip::keyCount() const {
+    return times.size();
+}
+
+size_t CompressedClip::memoryUsage() const {
+    return tracks.size() * sizeof(Track) + times.size() * sizeof(uint16_t) + values.size() * sizeof(uint16_t);
+}
+
+float CompressedClip::startTime() const {
+    return start;
+}
+
+float CompressedClip::endTime() const {
+    return end;
+}
+
+float CompressedClip::duration() const {
+    return endTime() - start;
+}
+
+// Decompression
+
+Vector3f CompressedClip::decodeVector(const Channel& channel, uint32_t key) const {
+    const uint16_t* q = &values[static_cast<size_t>(key) * 3];
+    return channel.min + Vector3f(q[0], q[1], q[2]) * (1.0f / MAX_FRACTION) * channel.extent;
+}
+
+Quaternion<float> CompressedClip::decodeRotation(uint32_t key) const {
+    return unpackQuaternion(&values[static_cast<size_t>(key) * 3]);
+}
+
+void CompressedClip::sampleTrack(const Track& track, float time, Transform<float>& out, AnimationTrack::Cursor& cursor) const {
+    const float tick = (time - start) / tickDuration;
+
+    if (track.position.count > 1) {
+        const uint16_t* ticks = &times[track.position.first];
+        cursor.position = seek(ticks, track.position.count, tick, cursor.position);
+        float t = segmentFactor(ticks, cursor.position, tick);
+        Vector3f a = decodeVector(track.position, track.position.first + cursor.position);
+        Vector3f b = decodeVector(track.position, track.position.first + cursor.position + 1);
+        out.setPosition(a + (b - a) * t);
+    } else if (track.position.count == 1) {
+        out.setPosition(decodeVector(track.position, track.position.first));
+    }
+
+    if (track.rotation.count > 1) {
+        const uint16_t* ticks = &times[track.rotation.first];
+        cursor.rotation = seek(ticks, track.rotation.count, tick, cursor.rotation);
+        float t = segmentFactor(ticks, cursor.rotation, tick);
+        out.setRotation(Quaternion<float>::slerp(decodeRotation(track.rotation.first + cursor.rotation),
+                                                 decodeRotation(track.rotation.first + cursor.rotation + 1), t));
+    } else if (track.rotation.count == 1) {
+        out.setRotation(decodeRotation(track.rotation.first));
+    }
+
+    if (track.scale.count > 1) {
+        const uint16_t* ticks = &times[track.scale.first];
+        cursor.scale = seek(ticks, track.scale.count, tick, cursor.scale);
+        float t = segmentFactor(ticks, cursor.scale, tick);
+        Vector3f a = decodeVector(track.scale, track.scale.first + cursor.scale);
+        Vector3f b = decodeVector(track.scale, track.scale.first + cursor.scale + 1);
+        out.setScale(a + (b - a) * t);
+    } else if (track.scale.count == 1) {
+        out.setScale(decodeVector(track.scale, track.scale.first));
+    }
+}
+
+void CompressedClip::sample(float time, std::span<Transform<float>> pose, std::span<AnimationTrack::Cursor> cursors) const {
+    if (cursors.size() < tracks.size()) {
+        throw std::invalid_argument("Need one cursor per track");
+    }
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        if (tracks[i].bone < pose.size()) {
+            sampleTrack(tracks[i], time, pose[tracks[i].bone], cursors[i]);
+        }
+    }
+}
+
+void CompressedClip::sample(float time, std::span<Transform<float>> pose) const {
+    for (const Track& track : tracks) {
+        if (track.bone < pose.size()) {
+            AnimationTrack::Cursor cursor;
+            sampleTrack(track, time, pose[track.bone], cursor);
+        }
+    }
+}
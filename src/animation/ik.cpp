@@ -0,0 +1,264 @@
+#include "../../include/animation/ik.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    constexpr float EPSILON = 1e-6f;
+
+    Vector3f anyPerpendicular(const Vector3f& v) {
+        Vector3f axis = std::abs(v.x) < 0.9f ? Vector3f(1, 0, 0) : Vector3f(0, 1, 0);
+        return v.cross(axis).normalized();
+    }
+
+    Vector3f directionOr(const Vector3f& v, const Vector3f& fallback) {
+        float length = v.length();
+        return length > EPSILON ? v / length : fallback;
+    }
+
+    // Rotation of v about the unit axis by the angle with the given cosine and sine
+    Vector3f rotateAround(const Vector3f& v, const Vector3f& axis, float cosAngle, float sinAngle) {
+        return v * cosAngle + axis.cross(v) * sinAngle + axis * (axis.dot(v) * (1.0f - cosAngle));
+    }
+
+    // Limits the angle between the unit vectors axis and direction to maxAngle
+    Vector3f clampCone(const Vector3f& axis, const Vector3f& direction, float maxAngle) {
+        float cosAngle = std::clamp(axis.dot(direction), -1.0f, 1.0f);
+        if (cosAngle >= std::cos(maxAngle)) {
+            return direction;
+        }
+        Vector3f side = directionOr(direction - axis * cosAngle, anyPerpendicular(axis));
+        return axis * std::cos(maxAngle) + side * std::sin(maxAngle);
+    }
+
+    // Turns joints after pivot so that from (relative to the pivot) points along to
+    void rotateSubChain(std::span<Vector3f> joints, size_t pivot, const Vector3f& from, const Vector3f& to) {
+        Vector3f a = directionOr(from, Vector3f());
+        Vector3f b = directionOr(to, Vector3f());
+        Vector3f axis = a.cross(b);
+        float sinAngle = axis.length();
+        if (sinAngle < EPSILON) {
+            return;
+        }
+        axis = axis / sinAngle;
+        float cosAngle = a.dot(b);
+        const Vector3f origin = joints[pivot];
+        for (size_t k = pivot + 1; k < joints.size(); ++k) {
+            joints[k] = origin + rotateAround(joints[k] - origin, axis, cosAngle, sinAngle);
+        }
+    }
+
+    // Segment lengths, reused per thread so repeated solves do not allocate
+    std::span<const float> segmentLengths(std::span<const Vector3f> joints, float& total) {
+        thread_local std::vector<float> lengths;
+        lengths.resize(joints.size() - 1);
+        total = 0.0f;
+        for (size_t i = 0; i + 1 < joints.size(); ++i) {
+            lengths[i] = (joints[i + 1] - joints[i]).length();
+            total += lengths[i];
+        }
+        return lengths;
+    }
+
+    IK::Result finish(std::span<const Vector3f> joints, const Vector3f& target, float tolerance, int iterations) {
+        IK::Result result;
+        result.iterations = iterations;
+        result.error = (joints.back() - target).length();
+        result.reached = result.error <= tolerance;
+        return result;
+    }
+
+    template<typename Solve>
+    void solveChains(std::span<Vector3f> joints, std::span<const uint32_t> chainOffsets,
+                     std::span<const Vector3f> targets, std::span<const float> coneLimits,
+                     std::span<IK::Result> results, size_t threadCount, Solve&& solve) {
+        size_t chains = chainOffsets.empty() ? 0 : chainOffsets.size() - 1;
+        if (targets.size() < chains) {
+            throw std::invalid_argument("Need one target per chain");
+        }
+        if (!coneLimits.empty() && coneLimits.size() < joints.size()) {
+            throw std::invalid_argument("Cone limits must cover every joint");
+        }
+        if (!results.empty() && results.size() < chains) {
+            throw std::invalid_argument("Need one result per chain");
+        }
+
+        Parallel::forRange(chains, threadCount, 16, [&](size_t begin, size_t end, size_t) {
+            for (size_t c = begin; c < end; ++c) {
+                size_t first = chainOffsets[c];
+                size_t count = chainOffsets[c + 1] - first;
+                std::span<const float> limits = coneLimits.empty() ? std::span<const float>() : coneLimits.subspan(first, count);
+                IK::Result result = solve(joints.subspan(first, count), targets[c], limits);
+                if (!results.empty()) {
+                    results[c] = result;
+                }
+            }
+        });
+    }
+}
+
+// FABRIK
+
+IK::Result IK::solveFABRIK(std::span<Vector3f> joints, const Vector3f& target,
+                           const Settings& settings, std::span<const float> coneLimits) {
+    if (joints.size() < 2) {
+        return joints.empty() ? Result() : finish(joints, target, settings.tolerance, 0);
+    }
+    const size_t n = joints.size();
+    float total;
+    std::span<const float> lengths = segmentLengths(joints, total);
+    const Vector3f root = joints[0];
+
+    // Out of reach: stretch the chain straight at the target
+    if ((target - root).length() >= total) {
+        Vector3f direction = directionOr(target - root, directionOr(joints[n - 1] - root, Vector3f(0, 1, 0)));
+        for (size_t i = 0; i + 1 < n; ++i) {
+            joints[i + 1] = joints[i] + direction * lengths[i];
+        }
+        return finish(joints, target, settings.tolerance, 0);
+    }
+
+    int iteration = 0;
+    while (iteration < settings.maxIterations && (joints[n - 1] - target).length() > settings.tolerance) {
+        ++iteration;
+
+        // Forward reaching: pin the end effector to the target
+        joints[n - 1] = target;
+        for (size_t i = n - 1; i-- > 0;) {
+            Vector3f direction = directionOr(joints[i] - joints[i + 1], Vector3f(0, -1, 0));
+            joints[i] = joints[i + 1] + direction * lengths[i];
+        }
+
+        // Backward reaching: pin the root back in place, enforcing joint cones
+        joints[0] = root;
+        for (size_t i = 0; i + 1 < n; ++i) {
+            Vector3f direction = directionOr(joints[i + 1] - joints[i], Vector3f(0, 1, 0));
+            if (!coneLimits.empty() && i > 0) {
+                Vector3f parent = directionOr(joints[i] - joints[i - 1], direction);
+                direction = clampCone(parent, direction, coneLimits[i]);
+            }
+            joints[i + 1] = joints[i] + direction * lengths[i];
+        }
+    }
+    return finish(joints, target, settings.tolerance, iteration);
+}
+
+// CCD
+
+IK::Result IK::solveCCD(std::span<Vector3f> joints, const Vector3f& target,
+                        const Settings& settings, std::span<const float> coneLimits) {
+    if (joints.size() < 2) {
+        return joints.empty() ? Result() : finish(joints, target, settings.tolerance, 0);
+    }
+    const size_t n = joints.size();
+
+    int iteration = 0;
+    while (iteration < settings.maxIterations && (joints[n - 1] - target).length() > settings.tolerance) {
+        ++iteration;
+        for (size_t i = n - 1; i-- > 0;) {
+            rotateSubChain(joints, i, joints[n - 1] - joints[i], target - joints[i]);
+
+            if (!coneLimits.empty() && i > 0) {
+                Vector3f segment = joints[i + 1] - joints[i];
+                Vector3f parent = directionOr(joints[i] - joints[i - 1], Vector3f());
+                Vector3f direction = directionOr(segment, parent);
+                rotateSubChain(joints, i, segment, clampCone(parent, direction, coneLimits[i]));
+            }
+        }
+    }
+    return finish(joints, target, settings.tolerance, iteration);
+}
+
+// Two-bone
+
+bool IK::solveTwoBone(const Vector3f& root, Vector3f& mid, Vector3f& end,
+                      const Vector3f& target, const Vector3f& pole) {
+    const float upper = (mid - root).length();
+    const float lower = (end - mid).length();
+    Vector3f toTarget = target - root;
+    float distance = toTarget.length();
+    Vector3f direction = directionOr(toTarget, directionOr(end - root, Vector3f(0, 1, 0)));
+
+    const float minReach = std::abs(upper - lower);
+    const float maxReach = upper + lower;
+    bool reachable = distance >= minReach && distance <= maxReach;
+    float reach = std::clamp(distance, minReach, maxReach);
+
+    // Bend in the plane spanned by the target direction and the pole
+    Vector3f bend = pole - root;
+    bend = bend - direction * bend.dot(direction);
+    if (bend.length() < EPSILON) {
+        bend = mid - root;
+        bend = bend - direction * bend.dot(direction);
+    }
+    bend = directionOr(bend, anyPerpendicular(direction));
+
+    // Law of cosines for the angle at the root
+    float cosAngle = 1.0f;
+    if (upper > EPSILON && reach > EPSILON) {
+        cosAngle = std::clamp((upper * upper + reach * reach - lower * lower) / (2.0f * upper * reach), -1.0f, 1.0f);
+    }
+    float sinAngle = std::sqrt(1.0f - cosAngle * cosAngle);
+
+    mid = root + direction * (upper * cosAngle) + bend * (upper * sinAngle);
+    end = root + direction * reach;
+    return reachable;
+}
+
+// Batch solvers
+
+void IK::solveFABRIK(std::span<Vector3f> joints, std::span<const uint32_t> chainOffsets,
+                     std::span<const Vector3f> targets, const Settings& settings,
+                     std::span<const float> coneLimits, std::span<Result> results, size_t threadCount) {
+    solveChains(joints, chainOffsets, targets, coneLimits, results, threadCount,
+                [&](std::span<Vector3f> chain, const Vector3f& target, std::span<const float> limits) {
+                    return solveFABRIK(chain, target, settings, limits);
+                });
+}
+
+void IK::solveCCD(std::span<Vector3f> joints, std::span<const uint32_t> chainOffsets,
+                  std::span<const Vector3f> targets, const Settings& settings,
+                  std::span<const float> coneLimits, std::span<Result> results, size_t threadCount) {
+    solveChains(joints, chainOffsets, targets, coneLimits, results, threadCount,
+                [&](std::span<Vector3f> chain, const Vector3f& target, std::span<const float> limits) {
+                    return solveCCD(chain, target, settings, limits);
+                });
+}
+
+void IK::solveTwoBone(std::span<const Vector3f> roots, std::span<Vector3f> mids, std::span<Vector3f> ends,
+                      std::span<const Vector3f> targets, std::span<const Vector3f> poles, size_t threadCount) {
+    size_t count = std::min({ roots.size(), mids.size(), ends.size(), targets.size(), poles.size() });
+    Parallel::forRange(count, threadCount, 256, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            solveTwoBone(roots[i], mids[i], ends[i], targets[i], poles[i]);
+        }
+    });
+}
+
+// Rotations
+
+Quaternion<float> IK::rotationBetween(const Vector3f& from, const Vector3f& to) {
+    Vector3f a = directionOr(from, Vector3f(0, 1, 0));
+    Vector3f b = directionOr(to, Vector3f(0, 1, 0));
+    float d = a.dot(b);
+    if (d < -1.0f + EPSILON) {
+        return Quaternion<float>(anyPerpendicular(a), 3.14159265358979323846f);
+    }
+    Vector3f axis = a.cross(b);
+    return Quaternion<float>(1.0f + d, axis.x, axis.y, axis.z).normalized();
+}
+
+void IK::applyChainRotations(std::span<const Vector3f> original, std::span<const Vector3f> solved,
+                             std::span<Quaternion<float>> worldRotations) {
+    size_t count = std::min({ original.size(), solved.size(), worldRotations.size() });
+    Quaternion<float> delta;
+    for (size_t i = 0; i + 1 < count; ++i) {
+        delta = rotationBetween(original[i + 1] - original[i], solved[i + 1] - solved[i]);
+        worldRotations[i] = delta * worldRotations[i];
+    }
+    if (count > 0) {
+        worldRotations[count - 1] = delta * worldRotations[count - 1];
+    }
+}
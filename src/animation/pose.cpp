@@ -0,0 +1,224 @@
+#include "../../include/animation/pose.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Pose
+
+Pose::Pose() {}
+
+Pose::Pose(size_t boneCount) {
+    resize(boneCount);
+}
+
+size_t Pose::size() const {
+    return px.size();
+}
+
+void Pose::resize(size_t boneCount) {
+    // New bones start at the identity transform
+    px.resize(boneCount, 0.0f);
+    py.resize(boneCount, 0.0f);
+    pz.resize(boneCount, 0.0f);
+    qw.resize(boneCount, 1.0f);
+    qx.resize(boneCount, 0.0f);
+    qy.resize(boneCount, 0.0f);
+    qz.resize(boneCount, 0.0f);
+    sx.resize(boneCount, 1.0f);
+    sy.resize(boneCount, 1.0f);
+    sz.resize(boneCount, 1.0f);
+}
+
+void Pose::setIdentity() {
+    std::fill(px.begin(), px.end(), 0.0f);
+    std::fill(py.begin(), py.end(), 0.0f);
+    std::fill(pz.begin(), pz.end(), 0.0f);
+    std::fill(qw.begin(), qw.end(), 1.0f);
+    std::fill(qx.begin(), qx.end(), 0.0f);
+    std::fill(qy.begin(), qy.end(), 0.0f);
+    std::fill(qz.begin(), qz.end(), 0.0f);
+    std::fill(sx.begin(), sx.end(), 1.0f);
+    std::fill(sy.begin(), sy.end(), 1.0f);
+    std::fill(sz.begin(), sz.end(), 1.0f);
+}
+
+void Pose::setTransform(size_t bone, const Transform<float>& transform) {
+    Vector3f position = transform.getPosition();
+    Quaternion<float> rotation = transform.getRotation();
+    Vector3f scale = transform.getScale();
+    px[bone] = position.x; py[bone] = position.y; pz[bone] = position.z;
+    qw[bone] = rotation.getW(); qx[bone] = rotation.getX(); qy[bone] = rotation.getY(); qz[bone] = rotation.getZ();
+    sx[bone] = scale.x; sy[bone] = scale.y; sz[bone] = scale.z;
+}
+
+Transform<float> Pose::getTransform(size_t bone) const {
+    return Transform<float>(Vector3f(px[bone], py[bone], pz[bone]),
+                            Quaternion<float>(qw[bone], qx[bone], qy[bone], qz[bone]),
+                            Vector3f(sx[bone], sy[bone], sz[bone]));
+}
+
+void Pose::fromTransforms(std::span<const Transform<float>> transforms) {
+    resize(transforms.size());
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        setTransform(i, transforms[i]);
+    }
+}
+
+void Pose::toTransforms(std::span<Transform<float>> transforms) const {
+    size_t count = std::min(size(), transforms.size());
+    for (size_t i = 0; i < count; ++i) {
+        transforms[i] = getTransform(i);
+    }
+}
+
+// Blending
+
+namespace {
+    void checkSizes(const Pose& a, const Pose& b) {
+        if (a.size() != b.size()) {
+            throw std::invalid_argument("Poses must have the same number of bones");
+        }
+    }
+
+    void lerpChannel(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& out,
+                     size_t count, const float* weights, float weight) {
+        for (size_t i = 0; i < count; ++i) {
+            float w = weights ? weights[i] * weight : weight;
+            out[i] = a[i] + (b[i] - a[i]) * w;
+        }
+    }
+
+    // Shortest-path normalized lerp, written branch-free so the loop vectorizes
+    void nlerpRotations(const Pose& a, const Pose& b, Pose& out, size_t count,
+                        const float* weights, float weight) {
+        for (size_t i = 0; i < count; ++i) {
+            float w = weights ? weights[i] * weight : weight;
+            float dot = a.qw[i] * b.qw[i] + a.qx[i] * b.qx[i] + a.qy[i] * b.qy[i] + a.qz[i] * b.qz[i];
+            float wb = dot < 0.0f ? -w : w;
+            float wa = 1.0f - w;
+            float w0 = a.qw[i] * wa + b.qw[i] * wb;
+            float x0 = a.qx[i] * wa + b.qx[i] * wb;
+            float y0 = a.qy[i] * wa + b.qy[i] * wb;
+            float z0 = a.qz[i] * wa + b.qz[i] * wb;
+            float invLength = 1.0f / std::sqrt(w0 * w0 + x0 * x0 + y0 * y0 + z0 * z0);
+            out.qw[i] = w0 * invLength;
+            out.qx[i] = x0 * invLength;
+            out.qy[i] = y0 * invLength;
+            out.qz[i] = z0 * invLength;
+        }
+    }
+
+    void slerpRotations(const Pose& a, const Pose& b, Pose& out, size_t count,
+                        const float* weights, float weight) {
+        for (size_t i = 0; i < count; ++i) {
+            float w = weights ? weights[i] * weight : weight;
+            Quaternion<float> q = Quaternion<float>::slerp(Quaternion<float>(a.qw[i], a.qx[i], a.qy[i], a.qz[i]),
+                                                           Quaternion<float>(b.qw[i], b.qx[i], b.qy[i], b.qz[i]), w);
+            out.qw[i] = q.getW();
+            out.qx[i] = q.getX();
+            out.qy[i] = q.getY();
+            out.qz[i] = q.getZ();
+        }
+    }
+
+    void blendRange(const Pose& a, const Pose& b, Pose& out, size_t count, const float* weights,
+                    float weight, PoseBlend::RotationMode mode) {
+        lerpChannel(a.px, b.px, out.px, count, weights, weight);
+        lerpChannel(a.py, b.py, out.py, count, weights, weight);
+        lerpChannel(a.pz, b.pz, out.pz, count, weights, weight);
+        lerpChannel(a.sx, b.sx, out.sx, count, weights, weight);
+        lerpChannel(a.sy, b.sy, out.sy, count, weights, weight);
+        lerpChannel(a.sz, b.sz, out.sz, count, weights, weight);
+        if (mode == PoseBlend::RotationMode::Slerp) {
+            slerpRotations(a, b, out, count, weights, weight);
+        } else {
+            nlerpRotations(a, b, out, count, weights, weight);
+        }
+    }
+}
+
+void PoseBlend::blend(const Pose& a, const Pose& b, float weight, Pose& out, RotationMode mode) {
+    checkSizes(a, b);
+    out.resize(a.size());
+    blendRange(a, b, out, a.size(), nullptr, weight, mode);
+}
+
+void PoseBlend::blendMasked(const Pose& a, const Pose& b, std::span<const float> mask, float weight,
+                            Pose& out, RotationMode mode) {
+    checkSizes(a, b);
+    out.resize(a.size());
+    size_t masked = std::min(mask.size(), a.size());
+    blendRange(a, b, out, masked, mask.data(), weight, mode);
+
+    // Unmasked bones copy a
+    if (&out != &a) {
+        std::copy(a.px.begin() + masked, a.px.end(), out.px.begin() + masked);
+        std::copy(a.py.begin() + masked, a.py.end(), out.py.begin() + masked);
+        std::copy(a.pz.begin() + masked, a.pz.end(), out.pz.begin() + masked);
+        std::copy(a.qw.begin() + masked, a.qw.end(), out.qw.begin() + masked);
+        std::copy(a.qx.begin() + masked, a.qx.end(), out.qx.begin() + masked);
+        std::copy(a.qy.begin() + masked, a.qy.end(), out.qy.begin() + masked);
+        std::copy(a.qz.begin() + masked, a.qz.end(), out.qz.begin() + masked);
+        std::copy(a.sx.begin() + masked, a.sx.end(), out.sx.begin() + masked);
+        std::copy(a.sy.begin() + masked, a.sy.end(), out.sy.begin() + masked);
+        std::copy(a.sz.begin() + masked, a.sz.end(), out.sz.begin() + masked);
+    }
+}
+
+// Additive layers
+
+void PoseBlend::makeAdditive(const Pose& pose, const Pose& reference, Pose& out) {
+    checkSizes(pose, reference);
+    out.resize(pose.size());
+    for (size_t i = 0; i < pose.size(); ++i) {
+        out.px[i] = pose.px[i] - reference.px[i];
+        out.py[i] = pose.py[i] - reference.py[i];
+        out.pz[i] = pose.pz[i] - reference.pz[i];
+        out.sx[i] = reference.sx[i] != 0.0f ? pose.sx[i] / reference.sx[i] : 1.0f;
+        out.sy[i] = reference.sy[i] != 0.0f ? pose.sy[i] / reference.sy[i] : 1.0f;
+        out.sz[i] = reference.sz[i] != 0.0f ? pose.sz[i] / reference.sz[i] : 1.0f;
+
+        // conjugate(reference) * pose
+        float rw = reference.qw[i], rx = -reference.qx[i], ry = -reference.qy[i], rz = -reference.qz[i];
+        float w = pose.qw[i], x = pose.qx[i], y = pose.qy[i], z = pose.qz[i];
+        out.qw[i] = rw * w - rx * x - ry * y - rz * z;
+        out.qx[i] = rw * x + rx * w + ry * z - rz * y;
+        out.qy[i] = rw * y - rx * z + ry * w + rz * x;
+        out.qz[i] = rw * z + rx * y - ry * x + rz * w;
+    }
+}
+
+void PoseBlend::applyAdditive(const Pose& base, const Pose& additive, float weight, Pose& out, RotationMode mode) {
+    checkSizes(base, additive);
+    out.resize(base.size());
+    for (size_t i = 0; i < base.size(); ++i) {
+        out.px[i] = base.px[i] + additive.px[i] * weight;
+        out.py[i] = base.py[i] + additive.py[i] * weight;
+        out.pz[i] = base.pz[i] + additive.pz[i] * weight;
+        out.sx[i] = base.sx[i] * (1.0f + (additive.sx[i] - 1.0f) * weight);
+        out.sy[i] = base.sy[i] * (1.0f + (additive.sy[i] - 1.0f) * weight);
+        out.sz[i] = base.sz[i] * (1.0f + (additive.sz[i] - 1.0f) * weight);
+
+        // Additive rotation scaled from identity, then applied as base * delta
+        float w, x, y, z;
+        if (mode == RotationMode::Slerp) {
+            Quaternion<float> q = Quaternion<float>::slerp(Quaternion<float>(),
+                Quaternion<float>(additive.qw[i], additive.qx[i], additive.qy[i], additive.qz[i]), weight);
+            w = q.getW(); x = q.getX(); y = q.getY(); z = q.getZ();
+        } else {
+            float wd = additive.qw[i] < 0.0f ? -weight : weight;
+            w = 1.0f - weight + additive.qw[i] * wd;
+            x = additive.qx[i] * wd;
+            y = additive.qy[i] * wd;
+            z = additive.qz[i] * wd;
+            float invLength = 1.0f / std::sqrt(w * w + x * x + y * y + z * z);
+            w *= invLength; x *= invLength; y *= invLength; z *= invLength;
+        }
+
+        float bw = base.qw[i], bx = base.qx[i], by = base.qy[i], bz = base.qz[i];
+        out.qw[i] = bw * w - bx * x - by * y - bz * z;
+        out.qx[i] = bw * x + bx * w + by * z - bz * y;
+        out.qy[i] = bw * y - bx * z + by * w + bz * x;
+        out.qz[i] = bw * z + bx * y - by * x + bz * w;
+    }
+}
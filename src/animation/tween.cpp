@@ -0,0 +1,192 @@
+#include "../../include/animation/tween.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// Pool
+
+void TweenSystem::Pool::reserve(size_t capacity) {
+    from.reserve(capacity);
+    to.reserve(capacity);
+    invDuration.reserve(capacity);
+    elapsed.reserve(capacity);
+    t.reserve(capacity);
+    eased.reserve(capacity);
+    target.reserve(capacity);
+    slot.reserve(capacity);
+}
+
+// TweenSystem
+
+TweenSystem::TweenSystem() : targetLimit(0), active(0) {}
+
+void TweenSystem::reserve(size_t capacity) {
+    slots.reserve(capacity);
+    freeSlots.reserve(capacity);
+}
+
+void TweenSystem::reserve(size_t capacity, Interpolation::EaseType type) {
+    reserve(capacity);
+    pools[static_cast<size_t>(type)].reserve(capacity);
+}
+
+TweenSystem::Handle TweenSystem::start(float from, float to, float duration, Interpolation::EaseType type,
+                                       uint32_t target, float delay) {
+    size_t typeIndex = static_cast<size_t>(type);
+    if (typeIndex >= EASE_TYPE_COUNT) {
+        throw std::invalid_argument("Unknown ease type");
+    }
+    if (duration < 0.0f || delay < 0.0f) {
+        throw std::invalid_argument("Tween duration and delay must not be negative");
+    }
+
+    uint32_t slotIndex;
+    if (!freeSlots.empty()) {
+        slotIndex = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    Pool& pool = pools[typeIndex];
+    Slot& slot = slots[slotIndex];
+    slot.index = static_cast<uint32_t>(pool.size());
+    slot.type = static_cast<uint8_t>(typeIndex);
+    slot.active = true;
+
+    pool.from.push_back(from);
+    pool.to.push_back(to);
+    pool.invDuration.push_back(duration > 0.0f ? 1.0f / duration : std::numeric_limits<float>::max());
+    pool.elapsed.push_back(-delay);
+    pool.t.push_back(0.0f);
+    pool.eased.push_back(0.0f);
+    pool.target.push_back(target);
+    pool.slot.push_back(slotIndex);
+
+    targetLimit = std::max(targetLimit, target + 1);
+    ++active;
+    return Handle{ slotIndex, slot.generation };
+}
+
+bool TweenSystem::stop(Handle handle) {
+    if (!isActive(handle)) {
+        return false;
+    }
+    const Slot& slot = slots[handle.slot];
+    remove(pools[slot.type], slot.index);
+    return true;
+}
+
+bool TweenSystem::isActive(Handle handle) const {
+    return handle.slot < slots.size() && slots[handle.slot].active &&
+           slots[handle.slot].generation == handle.generation;
+}
+
+void TweenSystem::clear() {
+    for (Pool& pool : pools) {
+        pool.from.clear();
+        pool.to.clear();
+        pool.invDuration.clear();
+        pool.elapsed.clear();
+        pool.t.clear();
+        pool.eased.clear();
+        pool.target.clear();
+        pool.slot.clear();
+    }
+    // Keep generations so handles from before the clear stay invalid
+    freeSlots.clear();
+    for (uint32_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].active) {
+            slots[i].active = false;
+            ++slots[i].generation;
+        }
+        freeSlots.push_back(i);
+    }
+    targetLimit = 0;
+    active = 0;
+}
+
+void TweenSystem::remove(Pool& pool, uint32_t index) {
+    Slot& removed = slots[pool.slot[index]];
+    removed.active = false;
+    ++removed.generation;
+    freeSlots.push_back(pool.slot[index]);
+
+    // Move the last tween into the hole
+    size_t last = pool.size() - 1;
+    if (index != last) {
+        pool.from[index] = pool.from[last];
+        pool.to[index] = pool.to[last];
+        pool.invDuration[index] = pool.invDuration[last];
+        pool.elapsed[index] = pool.elapsed[last];
+        pool.t[index] = pool.t[last];
+        pool.eased[index] = pool.eased[last];
+        pool.target[index] = pool.target[last];
+        pool.slot[index] = pool.slot[last];
+        slots[pool.slot[index]].index = index;
+    }
+    pool.from.pop_back();
+    pool.to.pop_back();
+    pool.invDuration.pop_back();
+    pool.elapsed.pop_back();
+    pool.t.pop_back();
+    pool.eased.pop_back();
+    pool.target.pop_back();
+    pool.slot.pop_back();
+    --active;
+}
+
+size_t TweenSystem::update(float deltaTime, std::span<float> targets) {
+    if (active > 0 && targets.size() < targetLimit) {
+        throw std::invalid_argument("Targets must cover every tween's target slot");
+    }
+
+    size_t finished = 0;
+    for (size_t type = 0; type < EASE_TYPE_COUNT; ++type) {
+        Pool& pool = pools[type];
+        const size_t count = pool.size();
+        if (count == 0) {
+            continue;
+        }
+
+        float* elapsed = pool.elapsed.data();
+        float* t = pool.t.data();
+        const float* invDuration = pool.invDuration.data();
+        for (size_t i = 0; i < count; ++i) {
+            elapsed[i] += deltaTime;
+            t[i] = std::clamp(elapsed[i] * invDuration[i], 0.0f, 1.0f);
+        }
+
+        Interpolation::easeBatch(static_cast<Interpolation::EaseType>(type), pool.t, pool.eased);
+
+        const float* from = pool.from.data();
+        const float* to = pool.to.data();
+        const float* eased = pool.eased.data();
+        const uint32_t* target = pool.target.data();
+        for (size_t i = 0; i < count; ++i) {
+            targets[target[i]] = from[i] + (to[i] - from[i]) * eased[i];
+        }
+
+        // Backwards so swapped-in tweens have already been checked
+        for (size_t i = count; i-- > 0;) {
+            if (pool.t[i] >= 1.0f) {
+                remove(pool, static_cast<uint32_t>(i));
+                ++finished;
+            }
+        }
+    }
+    if (active == 0) {
+        targetLimit = 0;
+    }
+    return finished;
+}
+
+size_t TweenSystem::activeCount() const {
+    return active;
+}
+
+size_t TweenSystem::activeCount(Interpolation::EaseType type) const {
+    size_t typeIndex = static_cast<size_t>(type);
+    return typeIndex < EASE_TYPE_COUNT ? pools[typeIndex].size() : 0;
+}
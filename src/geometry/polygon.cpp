@@ -0,0 +1,192 @@
+#include "../../include/geometry/polygon.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Constructors
+
+template<typename T>
+ConvexPolygon2D<T>::ConvexPolygon2D() : count(0), box(0, 0, 0, 0) {}
+
+template<typename T>
+ConvexPolygon2D<T>::ConvexPolygon2D(std::span<const Vector2<T>> points) : count(0), box(0, 0, 0, 0) {
+    setVertices(points);
+}
+
+// Static methods
+
+template<typename T>
+ConvexPolygon2D<T> ConvexPolygon2D<T>::fromRect(const Rect<T>& rect) {
+    const Vector2<T> corners[4] = {
+        rect.topLeft(), rect.topRight(), rect.bottomRight(), rect.bottomLeft()
+    };
+    return ConvexPolygon2D<T>(std::span<const Vector2<T>>(corners, 4));
+}
+
+template<typename T>
+ConvexPolygon2D<T> ConvexPolygon2D<T>::regular(const Vector2<T>& center, T radius, size_t sides) {
+    sides = std::clamp(sides, static_cast<size_t>(3), MAX_VERTICES);
+    std::array<Vector2<T>, MAX_VERTICES> points;
+    const T step = static_cast<T>(6.28318530717958647692) / static_cast<T>(sides);
+    for (size_t i = 0; i < sides; ++i) {
+        T angle = step * static_cast<T>(i);
+        points[i] = Vector2<T>(center.x + radius * std::cos(angle), center.y + radius * std::sin(angle));
+    }
+    return ConvexPolygon2D<T>(std::span<const Vector2<T>>(points.data(), sides));
+}
+
+// Vertices
+
+template<typename T>
+void ConvexPolygon2D<T>::setVertices(std::span<const Vector2<T>> points) {
+    if (points.size() > MAX_VERTICES) {
+        throw std::invalid_argument("Convex polygon has more than MAX_VERTICES vertices");
+    }
+    count = points.size();
+    std::copy_n(points.begin(), count, vertices.begin());
+    rebuild();
+}
+
+template<typename T>
+void ConvexPolygon2D<T>::rebuild() {
+    if (count == 0) {
+        box = Rect<T>(0, 0, 0, 0);
+        return;
+    }
+
+    // Enforce counter-clockwise winding so normals point outward
+    T signedArea = 0;
+    for (size_t i = 0; i < count; ++i) {
+        signedArea += vertices[i].cross(vertices[(i + 1) % count]);
+    }
+    if (signedArea < 0) {
+        std::reverse(vertices.begin(), vertices.begin() + count);
+    }
+
+    Vector2<T> lo = vertices[0];
+    Vector2<T> hi = vertices[0];
+    for (size_t i = 0; i < count; ++i) {
+        const Vector2<T>& a = vertices[i];
+        const Vector2<T>& b = vertices[(i + 1) % count];
+        normals[i] = Vector2<T>(b.y - a.y, a.x - b.x).normalized();
+
+        lo.x = std::min(lo.x, a.x); lo.y = std::min(lo.y, a.y);
+        hi.x = std::max(hi.x, a.x); hi.y = std::max(hi.y, a.y);
+    }
+    box = Rect<T>::fromPoints(lo, hi);
+}
+
+template<typename T>
+size_t ConvexPolygon2D<T>::vertexCount() const {
+    return count;
+}
+
+template<typename T>
+const Vector2<T>& ConvexPolygon2D<T>::vertex(size_t index) const {
+    return vertices[index];
+}
+
+template<typename T>
+const Vector2<T>& ConvexPolygon2D<T>::normal(size_t index) const {
+    return normals[index];
+}
+
+template<typename T>
+const Rect<T>& ConvexPolygon2D<T>::bounds() const {
+    return box;
+}
+
+template<typename T>
+Vector2<T> ConvexPolygon2D<T>::centroid() const {
+    if (count == 0) {
+        return Vector2<T>();
+    }
+    Vector2<T> sum;
+    for (size_t i = 0; i < count; ++i) {
+        sum = sum + vertices[i];
+    }
+    return sum / static_cast<T>(count);
+}
+
+template<typename T>
+void ConvexPolygon2D<T>::translate(const Vector2<T>& offset) {
+    for (size_t i = 0; i < count; ++i) {
+        vertices[i] = vertices[i] + offset;
+    }
+    box += offset;
+}
+
+// Queries
+
+template<typename T>
+void ConvexPolygon2D<T>::project(const Vector2<T>& axis, T& min, T& max) const {
+    min = std::numeric_limits<T>::max();
+    max = std::numeric_limits<T>::lowest();
+    for (size_t i = 0; i < count; ++i) {
+        T projection = vertices[i].dot(axis);
+        min = std::min(min, projection);
+        max = std::max(max, projection);
+    }
+}
+
+template<typename T>
+bool ConvexPolygon2D<T>::contains(const Vector2<T>& point) const {
+    if (count < 3) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if ((point - vertices[i]).dot(normals[i]) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool ConvexPolygon2D<T>::intersects(const ConvexPolygon2D<T>& other, Vector2<T>* mtv) const {
+    if (count == 0 || other.count == 0) {
+        return false;
+    }
+
+    // Cheap bounds rejection before any projection
+    if (other.box.left() > box.right() || other.box.right() < box.left() ||
+        other.box.top() > box.bottom() || other.box.bottom() < box.top()) {
+        return false;
+    }
+
+    T minOverlap = std::numeric_limits<T>::max();
+    Vector2<T> minAxis;
+
+    const ConvexPolygon2D<T>* shapes[2] = { this, &other };
+    for (const ConvexPolygon2D<T>* shape : shapes) {
+        for (size_t i = 0; i < shape->count; ++i) {
+            const Vector2<T>& axis = shape->normals[i];
+            T min1, max1, min2, max2;
+            project(axis, min1, max1);
+            other.project(axis, min2, max2);
+
+            if (max1 < min2 || max2 < min1) {
+                return false;
+            }
+
+            T overlap = std::min(max1 - min2, max2 - min1);
+            if (overlap < minOverlap) {
+                minOverlap = overlap;
+                minAxis = axis;
+            }
+        }
+    }
+
+    if (mtv) {
+        if ((centroid() - other.centroid()).dot(minAxis) < 0) {
+            minAxis = minAxis * static_cast<T>(-1);
+        }
+        *mtv = minAxis * minOverlap;
+    }
+
+    return true;
+}
+
+// Explicit template instantiations
+template class ConvexPolygon2D<float>;
@@ -286,6 +286,47 @@ void Matrix3x3<T>::orthonormalize() {
     m[0][2] = z.x; m[1][2] = z.y; m[2][2] = z.z;
 }
 
+template<typename T>
+int Matrix3x3<T>::polarDecompose(Matrix3x3<T>& rotation, Matrix3x3<T>& stretch, int maxIterations, T tolerance) const {
+    Matrix3x3<T> r = *this;
+    int iteration = 0;
+    while (iteration < maxIterations) {
+        ++iteration;
+        
+        // R^-T is the cofactor matrix divided by the determinant
+        T c[3][3] = {
+            { r.m[1][1] * r.m[2][2] - r.m[1][2] * r.m[2][1], r.m[1][2] * r.m[2][0] - r.m[1][0] * r.m[2][2], r.m[1][0] * r.m[2][1] - r.m[1][1] * r.m[2][0] },
+            { r.m[0][2] * r.m[2][1] - r.m[0][1] * r.m[2][2], r.m[0][0] * r.m[2][2] - r.m[0][2] * r.m[2][0], r.m[0][1] * r.m[2][0] - r.m[0][0] * r.m[2][1] },
+            { r.m[0][1] * r.m[1][2] - r.m[0][2] * r.m[1][1], r.m[0][2] * r.m[1][0] - r.m[0][0] * r.m[1][2], r.m[0][0] * r.m[1][1] - r.m[0][1] * r.m[1][0] }
+        };
+        T det = r.m[0][0] * c[0][0] + r.m[0][1] * c[0][1] + r.m[0][2] * c[0][2];
+        if (det == 0) {
+            break;
+        }
+        
+        // Determinant scaling speeds up the early steps considerably
+        T gamma = static_cast<T>(std::pow(std::abs(static_cast<double>(det)), -1.0 / 3.0));
+        T a = gamma / 2;
+        T b = 1 / (2 * gamma * det);
+        
+        T change = 0;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                T next = a * r.m[i][j] + b * c[i][j];
+                change += (next - r.m[i][j]) * (next - r.m[i][j]);
+                r.m[i][j] = next;
+            }
+        }
+        if (change <= tolerance * tolerance) {
+            break;
+        }
+    }
+    
+    rotation = r;
+    stretch = r.transposed() * (*this);
+    return iteration;
+}
+
 template<typename T>
 Matrix3x3<T> Matrix3x3<T>::fromAxisAngle(const Vector3<T>& axis, T angle) {
     T cosAngle = static_cast<T>(std::cos(angle));
@@ -60,6 +60,11 @@ Matrix4x4<T> Matrix4x4<T>::scale(T x, T y, T z) {
     return result;
 }
 
+template<typename T>
+Matrix4x4<T> Matrix4x4<T>::scale(const Vector3<T>& vec) {
+    return scale(vec.x, vec.y, vec.z);
+}
+
 template<typename T>
 Matrix4x4<T> Matrix4x4<T>::rotationX(T angle) {
     T cosAngle = static_cast<T>(std::cos(angle));
@@ -0,0 +1,120 @@
+#include "../../include/quaternions/dualquaternion.hpp"
+
+// Constructors
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion() : real(1, 0, 0, 0), dual(0, 0, 0, 0) {}
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion(const Quaternion<T>& real, const Quaternion<T>& dual) : real(real), dual(dual) {}
+
+template<typename T>
+DualQuaternion<T>::DualQuaternion(const Quaternion<T>& rotation, const Vector3<T>& translation) : real(rotation) {
+    dual = Quaternion<T>(0, translation.x, translation.y, translation.z) * rotation * static_cast<T>(0.5);
+}
+
+// Components
+
+template<typename T>
+const Quaternion<T>& DualQuaternion<T>::getReal() const {
+    return real;
+}
+
+template<typename T>
+const Quaternion<T>& DualQuaternion<T>::getDual() const {
+    return dual;
+}
+
+template<typename T>
+Quaternion<T> DualQuaternion<T>::getRotation() const {
+    return real;
+}
+
+template<typename T>
+Vector3<T> DualQuaternion<T>::getTranslation() const {
+    Quaternion<T> t = dual * real.conjugate() * static_cast<T>(2);
+    return Vector3<T>(t.getX(), t.getY(), t.getZ());
+}
+
+// Normalization
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::normalized() const {
+    DualQuaternion<T> result = *this;
+    result.normalize();
+    return result;
+}
+
+template<typename T>
+void DualQuaternion<T>::normalize() {
+    T lenSq = real.dot(real);
+    if (lenSq == 0) {
+        *this = DualQuaternion<T>();
+        return;
+    }
+    T invLen = 1 / static_cast<T>(std::sqrt(lenSq));
+    real = real * invLen;
+    dual = dual * invLen;
+
+    // Remove the component of dual along real so the result stays rigid
+    dual = dual + real * -real.dot(dual);
+}
+
+// Arithmetic
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::operator+(const DualQuaternion<T>& other) const {
+    return DualQuaternion<T>(real + other.real, dual + other.dual);
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::operator*(T scalar) const {
+    return DualQuaternion<T>(real * scalar, dual * scalar);
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::operator*(const DualQuaternion<T>& other) const {
+    return DualQuaternion<T>(real * other.real, real * other.dual + dual * other.real);
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::conjugate() const {
+    return DualQuaternion<T>(real.conjugate(), dual.conjugate());
+}
+
+template<typename T>
+T DualQuaternion<T>::dot(const DualQuaternion<T>& other) const {
+    return real.dot(other.real);
+}
+
+// Transformations
+
+template<typename T>
+Vector3<T> DualQuaternion<T>::transformPoint(const Vector3<T>& point) const {
+    return real.rotate(point) + getTranslation();
+}
+
+template<typename T>
+Vector3<T> DualQuaternion<T>::transformVector(const Vector3<T>& vector) const {
+    return real.rotate(vector);
+}
+
+template<typename T>
+Matrix4x4<T> DualQuaternion<T>::toMatrix() const {
+    Matrix4x4<T> result = real.toMatrix();
+    Vector3<T> translation = getTranslation();
+    result[0][3] = translation.x;
+    result[1][3] = translation.y;
+    result[2][3] = translation.z;
+    return result;
+}
+
+template<typename T>
+DualQuaternion<T> DualQuaternion<T>::fromMatrix(const Matrix4x4<T>& mat) {
+    return DualQuaternion<T>(Quaternion<T>::fromMatrix(mat).normalized(),
+                             Vector3<T>(mat[0][3], mat[1][3], mat[2][3]));
+}
+
+// Explicit template instantiations
+template class DualQuaternion<float>;
+template class DualQuaternion<double>;
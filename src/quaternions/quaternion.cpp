@@ -1,4 +1,5 @@
 #include "../../include/quaternions/quaternion.hpp"
+#include <algorithm>
 
 // Constructors
 
@@ -16,6 +17,20 @@ Quaternion<T>::Quaternion(const Vector3<T>& axis, T angle) {
     z = normalizedAxis.z * sinHalfAngle;
 }
 
+// Components
+
+template<typename T>
+T Quaternion<T>::getW() const { return w; }
+
+template<typename T>
+T Quaternion<T>::getX() const { return x; }
+
+template<typename T>
+T Quaternion<T>::getY() const { return y; }
+
+template<typename T>
+T Quaternion<T>::getZ() const { return z; }
+
 // Normalization
 
 template<typename T>
@@ -55,6 +70,23 @@ Quaternion<T> Quaternion<T>::inverse() const {
     return Quaternion<T>(w * invLenSq, -x * invLenSq, -y * invLenSq, -z * invLenSq);
 }
 
+// Component-wise arithmetic
+
+template<typename T>
+Quaternion<T> Quaternion<T>::operator+(const Quaternion<T>& other) const {
+    return Quaternion<T>(w + other.w, x + other.x, y + other.y, z + other.z);
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::operator*(T scalar) const {
+    return Quaternion<T>(w * scalar, x * scalar, y * scalar, z * scalar);
+}
+
+template<typename T>
+T Quaternion<T>::dot(const Quaternion<T>& other) const {
+    return w * other.w + x * other.x + y * other.y + z * other.z;
+}
+
 // Multiplication
 
 template<typename T>
@@ -75,6 +107,11 @@ Vector3<T> Quaternion<T>::operator*(const Vector3<T>& vec) const {
     return Vector3<T>(result.x, result.y, result.z);
 }
 
+template<typename T>
+Vector3<T> Quaternion<T>::rotate(const Vector3<T>& vec) const {
+    return (*this) * vec;
+}
+
 // Interpolation
 
 template<typename T>
@@ -118,6 +155,55 @@ Quaternion<T> Quaternion<T>::slerp(const Quaternion<T>& a, const Quaternion<T>&
     ).normalized();
 }
 
+template<typename T>
+Quaternion<T> Quaternion<T>::slerpFast(const Quaternion<T>& a, const Quaternion<T>& b, T t) {
+    T dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    T d = std::abs(dot);
+    
+    // Correction terms fitted over |dot| in [0, 1]; they vanish at t = 0, 0.5 and 1
+    T A = static_cast<T>(1.0904) + d * (static_cast<T>(-3.2452) + d * (static_cast<T>(3.55645) - d * static_cast<T>(1.43519)));
+    T B = static_cast<T>(0.848013) + d * (static_cast<T>(-1.06021) + d * static_cast<T>(0.215638));
+    T h = t - static_cast<T>(0.5);
+    T k = A * h * h + B;
+    T tc = t + t * h * (t - 1) * k;
+    
+    T wa = 1 - tc;
+    T wb = dot < 0 ? -tc : tc;
+    T rw = a.w * wa + b.w * wb;
+    T rx = a.x * wa + b.x * wb;
+    T ry = a.y * wa + b.y * wb;
+    T rz = a.z * wa + b.z * wb;
+    T invLen = 1 / static_cast<T>(std::sqrt(rw * rw + rx * rx + ry * ry + rz * rz));
+    return Quaternion<T>(rw * invLen, rx * invLen, ry * invLen, rz * invLen);
+}
+
+template<typename T>
+void Quaternion<T>::slerp(std::span<const Quaternion<T>> a, std::span<const Quaternion<T>> b,
+                          std::span<const T> t, std::span<Quaternion<T>> out) {
+    size_t count = std::min({ a.size(), b.size(), t.size(), out.size() });
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = slerp(a[i], b[i], t[i]);
+    }
+}
+
+template<typename T>
+void Quaternion<T>::slerpFast(std::span<const Quaternion<T>> a, std::span<const Quaternion<T>> b,
+                              std::span<const T> t, std::span<Quaternion<T>> out) {
+    size_t count = std::min({ a.size(), b.size(), t.size(), out.size() });
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = slerpFast(a[i], b[i], t[i]);
+    }
+}
+
+template<typename T>
+void Quaternion<T>::slerpFast(std::span<const Quaternion<T>> a, std::span<const Quaternion<T>> b,
+                              T t, std::span<Quaternion<T>> out) {
+    size_t count = std::min({ a.size(), b.size(), out.size() });
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = slerpFast(a[i], b[i], t);
+    }
+}
+
 // Transformations
 
 template<typename T>
@@ -152,38 +238,54 @@ Matrix4x4<T> Quaternion<T>::toMatrix() const {
 
 template<typename T>
 Quaternion<T> Quaternion<T>::fromMatrix(const Matrix4x4<T>& mat) {
-    T trace = mat[0][0] + mat[1][1] + mat[2][2];
+    return fromRotation(mat[0][0], mat[0][1], mat[0][2],
+                        mat[1][0], mat[1][1], mat[1][2],
+                        mat[2][0], mat[2][1], mat[2][2]);
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::fromMatrix(const Matrix3x3<T>& mat) {
+    return fromRotation(mat(0, 0), mat(0, 1), mat(0, 2),
+                        mat(1, 0), mat(1, 1), mat(1, 2),
+                        mat(2, 0), mat(2, 1), mat(2, 2));
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::fromRotation(T m00, T m01, T m02,
+                                          T m10, T m11, T m12,
+                                          T m20, T m21, T m22) {
+    T trace = m00 + m11 + m22;
     
     if (trace > 0) {
         T s = static_cast<T>(std::sqrt(trace + 1)) * 2;
         return Quaternion<T>(
             s / 4,
-            (mat[2][1] - mat[1][2]) / s,
-            (mat[0][2] - mat[2][0]) / s,
-            (mat[1][0] - mat[0][1]) / s
+            (m21 - m12) / s,
+            (m02 - m20) / s,
+            (m10 - m01) / s
         );
-    } else if (mat[0][0] > mat[1][1] && mat[0][0] > mat[2][2]) {
-        T s = static_cast<T>(std::sqrt(1 + mat[0][0] - mat[1][1] - mat[2][2])) * 2;
+    } else if (m00 > m11 && m00 > m22) {
+        T s = static_cast<T>(std::sqrt(1 + m00 - m11 - m22)) * 2;
         return Quaternion<T>(
-            (mat[2][1] - mat[1][2]) / s,
+            (m21 - m12) / s,
             s / 4,
-            (mat[1][0] + mat[0][1]) / s,
-            (mat[0][2] + mat[2][0]) / s
+            (m10 + m01) / s,
+            (m02 + m20) / s
         );
-    } else if (mat[1][1] > mat[2][2]) {
-        T s = static_cast<T>(std::sqrt(1 + mat[1][1] - mat[0][0] - mat[2][2])) * 2;
+    } else if (m11 > m22) {
+        T s = static_cast<T>(std::sqrt(1 + m11 - m00 - m22)) * 2;
         return Quaternion<T>(
-            (mat[0][2] - mat[2][0]) / s,
-            (mat[1][0] + mat[0][1]) / s,
+            (m02 - m20) / s,
+            (m10 + m01) / s,
             s / 4,
-            (mat[2][1] + mat[1][2]) / s
+            (m21 + m12) / s
         );
     } else {
-        T s = static_cast<T>(std::sqrt(1 + mat[2][2] - mat[0][0] - mat[1][1])) * 2;
+        T s = static_cast<T>(std::sqrt(1 + m22 - m00 - m11)) * 2;
         return Quaternion<T>(
-            (mat[1][0] - mat[0][1]) / s,
-            (mat[0][2] + mat[2][0]) / s,
-            (mat[2][1] + mat[1][2]) / s,
+            (m10 - m01) / s,
+            (m02 + m20) / s,
+            (m21 + m12) / s,
             s / 4
         );
     }
@@ -208,6 +310,28 @@ Quaternion<T> Quaternion<T>::fromAxisAngle(const Vector3<T>& axis, T angle) {
     return Quaternion<T>(axis, angle);
 }
 
+// Exponential map
+
+template<typename T>
+Vector3<T> Quaternion<T>::log() const {
+    T s = static_cast<T>(std::sqrt(x * x + y * y + z * z));
+    if (s < static_cast<T>(1e-7)) {
+        return Vector3<T>(x, y, z);
+    }
+    T halfAngle = static_cast<T>(std::atan2(s, w));
+    return Vector3<T>(x, y, z) * (halfAngle / s);
+}
+
+template<typename T>
+Quaternion<T> Quaternion<T>::exp(const Vector3<T>& v) {
+    T halfAngle = v.length();
+    if (halfAngle < static_cast<T>(1e-7)) {
+        return Quaternion<T>(1, v.x, v.y, v.z).normalized();
+    }
+    T scale = static_cast<T>(std::sin(halfAngle)) / halfAngle;
+    return Quaternion<T>(static_cast<T>(std::cos(halfAngle)), v.x * scale, v.y * scale, v.z * scale);
+}
+
 // Euler angles
 
 template<typename T>
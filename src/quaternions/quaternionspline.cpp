@@ -0,0 +1,188 @@
+#include "../../include/quaternions/quaternionspline.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Slerp without the shortest-arc flip; squad's inner controls must be
+    // interpolated along the arc they were built on
+    template<typename T>
+    Quaternion<T> slerpDirect(const Quaternion<T>& a, const Quaternion<T>& b, T t) {
+        T d = std::clamp(a.dot(b), static_cast<T>(-1), static_cast<T>(1));
+        if (std::abs(d) > static_cast<T>(0.9995)) {
+            return (a * (1 - t) + b * t).normalized();
+        }
+        T theta = static_cast<T>(std::acos(d));
+        T invSin = 1 / static_cast<T>(std::sin(theta));
+        T wa = static_cast<T>(std::sin((1 - t) * theta)) * invSin;
+        T wb = static_cast<T>(std::sin(t * theta)) * invSin;
+        return a * wa + b * wb;
+    }
+
+    // Keys flipped where needed so neighbours are at most 180 degrees apart
+    template<typename T>
+    std::vector<Quaternion<T>> alignKeys(std::span<const Quaternion<T>> keys) {
+        std::vector<Quaternion<T>> aligned(keys.begin(), keys.end());
+        for (size_t i = 0; i < aligned.size(); ++i) {
+            aligned[i].normalize();
+            if (i > 0 && aligned[i - 1].dot(aligned[i]) < 0) {
+                aligned[i] = aligned[i] * static_cast<T>(-1);
+            }
+        }
+        return aligned;
+    }
+
+    // Relative rotation from a to b, in log space
+    template<typename T>
+    Vector3<T> logDelta(const Quaternion<T>& a, const Quaternion<T>& b) {
+        return (a.conjugate() * b).log();
+    }
+}
+
+// Construction
+
+template<typename T>
+QuaternionSpline<T>::QuaternionSpline() : mode(Mode::Squad) {}
+
+template<typename T>
+QuaternionSpline<T>::QuaternionSpline(std::span<const Quaternion<T>> keys, Mode mode) : mode(mode) {
+    build(keys, mode);
+}
+
+template<typename T>
+QuaternionSpline<T>::QuaternionSpline(std::span<const Quaternion<T>> keys,
+                                      std::span<const Vector3<T>> angularVelocities)
+    : mode(Mode::Hermite) {
+    build(keys, angularVelocities);
+}
+
+template<typename T>
+void QuaternionSpline<T>::build(std::span<const Quaternion<T>> keys, Mode mode) {
+    this->mode = mode;
+    squad.clear();
+    hermite.clear();
+    single = keys.empty() ? Quaternion<T>() : keys[0].normalized();
+    if (keys.size() < 2) {
+        return;
+    }
+    std::vector<Quaternion<T>> q = alignKeys(keys);
+    const size_t n = q.size();
+
+    if (mode == Mode::Hermite) {
+        // Average of the incoming and outgoing steps, one-sided at the ends.
+        // Log-space steps are half angles, so their average doubled is in + out.
+        std::vector<Vector3<T>> tangents(n);
+        for (size_t i = 0; i < n; ++i) {
+            Vector3<T> in = i > 0 ? logDelta(q[i - 1], q[i]) : logDelta(q[i], q[i + 1]);
+            Vector3<T> out = i + 1 < n ? logDelta(q[i], q[i + 1]) : in;
+            tangents[i] = in + out;
+        }
+        buildHermite(q, tangents);
+        return;
+    }
+
+    // s_i = q_i exp(-(log(q_i^-1 q_i+1) + log(q_i^-1 q_i-1)) / 4), keys at the ends
+    std::vector<Quaternion<T>> s(n);
+    s[0] = q[0];
+    s[n - 1] = q[n - 1];
+    for (size_t i = 1; i + 1 < n; ++i) {
+        Vector3<T> sum = logDelta(q[i], q[i + 1]) + logDelta(q[i], q[i - 1]);
+        s[i] = q[i] * Quaternion<T>::exp(sum * static_cast<T>(-0.25));
+    }
+    squad.reserve(n - 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        squad.push_back({ q[i], q[i + 1], s[i], s[i + 1] });
+    }
+}
+
+template<typename T>
+void QuaternionSpline<T>::build(std::span<const Quaternion<T>> keys, std::span<const Vector3<T>> angularVelocities) {
+    if (angularVelocities.size() != keys.size()) {
+        throw std::invalid_argument("Need one angular velocity per key");
+    }
+    mode = Mode::Hermite;
+    squad.clear();
+    hermite.clear();
+    single = keys.empty() ? Quaternion<T>() : keys[0].normalized();
+    if (keys.size() < 2) {
+        return;
+    }
+    buildHermite(alignKeys(keys), angularVelocities);
+}
+
+template<typename T>
+void QuaternionSpline<T>::buildHermite(std::span<const Quaternion<T>> keys, std::span<const Vector3<T>> tangents) {
+    // Bezier controls a third of the way along each tangent (in log space,
+    // half the angular velocity), then the cumulative form's three steps
+    hermite.reserve(keys.size() - 1);
+    const T sixth = static_cast<T>(1.0 / 6.0);
+    for (size_t i = 0; i + 1 < keys.size(); ++i) {
+        Vector3<T> w1 = tangents[i] * sixth;
+        Vector3<T> w3 = tangents[i + 1] * sixth;
+        Quaternion<T> a = keys[i] * Quaternion<T>::exp(w1);
+        Quaternion<T> b = keys[i + 1] * Quaternion<T>::exp(w3 * static_cast<T>(-1));
+        hermite.push_back({ keys[i], w1, logDelta(a, b), w3 });
+    }
+}
+
+// Evaluation
+
+template<typename T>
+Quaternion<T> QuaternionSpline<T>::evaluateSegment(size_t segment, T t) const {
+    if (mode == Mode::Squad) {
+        const SquadSegment& s = squad[segment];
+        return slerpDirect(slerpDirect(s.q0, s.q1, t), slerpDirect(s.s0, s.s1, t), 2 * t * (1 - t)).normalized();
+    }
+
+    // q(t) = q0 exp(w1 b1(t)) exp(w2 b2(t)) exp(w3 b3(t)) with cumulative Bernstein bases
+    const HermiteSegment& h = hermite[segment];
+    T u = 1 - t;
+    T b1 = 1 - u * u * u;
+    T b2 = t * t * (3 - 2 * t);
+    T b3 = t * t * t;
+    return (h.q0 * Quaternion<T>::exp(h.w1 * b1) * Quaternion<T>::exp(h.w2 * b2) *
+            Quaternion<T>::exp(h.w3 * b3)).normalized();
+}
+
+template<typename T>
+Quaternion<T> QuaternionSpline<T>::evaluate(T u) const {
+    const size_t segments = segmentCount();
+    if (segments == 0) {
+        return single;
+    }
+    u = std::clamp(u, static_cast<T>(0), static_cast<T>(segments));
+    size_t segment = std::min(static_cast<size_t>(u), segments - 1);
+    return evaluateSegment(segment, u - static_cast<T>(segment));
+}
+
+template<typename T>
+void QuaternionSpline<T>::evaluate(std::span<const T> u, std::span<Quaternion<T>> out) const {
+    const size_t count = std::min(u.size(), out.size());
+    const size_t segments = segmentCount();
+    if (segments == 0) {
+        std::fill(out.begin(), out.begin() + count, single);
+        return;
+    }
+    const T end = static_cast<T>(segments);
+    for (size_t i = 0; i < count; ++i) {
+        T x = std::clamp(u[i], static_cast<T>(0), end);
+        size_t segment = std::min(static_cast<size_t>(x), segments - 1);
+        out[i] = evaluateSegment(segment, x - static_cast<T>(segment));
+    }
+}
+
+// Properties
+
+template<typename T>
+size_t QuaternionSpline<T>::segmentCount() const {
+    return mode == Mode::Squad ? squad.size() : hermite.size();
+}
+
+template<typename T>
+typename QuaternionSpline<T>::Mode QuaternionSpline<T>::getMode() const {
+    return mode;
+}
+
+// Explicit template instantiations
+template class QuaternionSpline<float>;
+template class QuaternionSpline<double>;
@@ -0,0 +1,398 @@
+#include "../../include/transformations/hierarchy.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+namespace {
+    // Product of two affine matrices; the bottom row is known to be (0, 0, 0, 1)
+    template<typename T>
+    void multiplyAffine(const Matrix4x4<T>& a, const Matrix4x4<T>& b, Matrix4x4<T>& out) {
+        for (int i = 0; i < 3; ++i) {
+            out.m[i][0] = a.m[i][0] * b.m[0][0] + a.m[i][1] * b.m[1][0] + a.m[i][2] * b.m[2][0];
+            out.m[i][1] = a.m[i][0] * b.m[0][1] + a.m[i][1] * b.m[1][1] + a.m[i][2] * b.m[2][1];
+            out.m[i][2] = a.m[i][0] * b.m[0][2] + a.m[i][1] * b.m[1][2] + a.m[i][2] * b.m[2][2];
+            out.m[i][3] = a.m[i][0] * b.m[0][3] + a.m[i][1] * b.m[1][3] + a.m[i][2] * b.m[2][3] + a.m[i][3];
+        }
+        out.m[3][0] = 0; out.m[3][1] = 0; out.m[3][2] = 0; out.m[3][3] = 1;
+    }
+}
+
+// Constructors
+
+template<typename T>
+TransformHierarchy<T>::TransformHierarchy() : dirtyCount(0), partitionWorkers(0), partitionDirty(false) {}
+
+// Nodes
+
+template<typename T>
+void TransformHierarchy<T>::reserve(size_t count) {
+    localPositions.reserve(count);
+    localRotations.reserve(count);
+    localScales.reserve(count);
+    parents.reserve(count);
+    dirty.reserve(count);
+    worldMatrices.reserve(count);
+    depths.reserve(count);
+}
+
+template<typename T>
+void TransformHierarchy<T>::clear() {
+    localPositions.clear();
+    localRotations.clear();
+    localScales.clear();
+    parents.clear();
+    dirty.clear();
+    worldMatrices.clear();
+    depths.clear();
+    prefixNodes.clear();
+    bucketNodes.clear();
+    bucketOffsets.clear();
+    dirtyCount = 0;
+    partitionDirty = false;
+}
+
+template<typename T>
+size_t TransformHierarchy<T>::size() const {
+    return parents.size();
+}
+
+template<typename T>
+uint32_t TransformHierarchy<T>::addNode(uint32_t parent, const Transform<T>& local) {
+    if (parent != NO_PARENT && parent >= parents.size()) {
+        throw std::invalid_argument("Parent node does not exist");
+    }
+    uint32_t node = static_cast<uint32_t>(parents.size());
+    localPositions.push_back(local.getPosition());
+    localRotations.push_back(local.getRotation());
+    localScales.push_back(local.getScale());
+    parents.push_back(parent);
+    dirty.push_back(0);
+    worldMatrices.push_back(Matrix4x4<T>());
+    depths.push_back(parent == NO_PARENT ? 0 : depths[parent] + 1);
+    partitionDirty = true;
+    markDirty(node);
+    return node;
+}
+
+template<typename T>
+void TransformHierarchy<T>::setParent(uint32_t node, uint32_t parent) {
+    if (parent != NO_PARENT && parent >= node) {
+        throw std::invalid_argument("Parent must precede the node in the hierarchy");
+    }
+    parents[node] = parent;
+
+    // Descendants follow the node, so one forward pass refreshes their depths
+    depths[node] = parent == NO_PARENT ? 0 : depths[parent] + 1;
+    for (size_t i = node + 1; i < parents.size(); ++i) {
+        if (parents[i] != NO_PARENT && parents[i] >= node) {
+            depths[i] = depths[parents[i]] + 1;
+        }
+    }
+    partitionDirty = true;
+    markDirty(node);
+}
+
+template<typename T>
+uint32_t TransformHierarchy<T>::getParent(uint32_t node) const {
+    return parents[node];
+}
+
+// Local transforms
+
+template<typename T>
+void TransformHierarchy<T>::setLocalPosition(uint32_t node, const Vector3<T>& position) {
+    localPositions[node] = position;
+    markDirty(node);
+}
+
+template<typename T>
+void TransformHierarchy<T>::setLocalRotation(uint32_t node, const Quaternion<T>& rotation) {
+    localRotations[node] = rotation;
+    markDirty(node);
+}
+
+template<typename T>
+void TransformHierarchy<T>::setLocalScale(uint32_t node, const Vector3<T>& scale) {
+    localScales[node] = scale;
+    markDirty(node);
+}
+
+template<typename T>
+void TransformHierarchy<T>::setLocalTransform(uint32_t node, const Transform<T>& local) {
+    localPositions[node] = local.getPosition();
+    localRotations[node] = local.getRotation();
+    localScales[node] = local.getScale();
+    markDirty(node);
+}
+
+template<typename T>
+Transform<T> TransformHierarchy<T>::getLocalTransform(uint32_t node) const {
+    return Transform<T>(localPositions[node], localRotations[node], localScales[node]);
+}
+
+template<typename T>
+const std::vector<Vector3<T>>& TransformHierarchy<T>::getLocalPositions() const {
+    return localPositions;
+}
+
+template<typename T>
+const std::vector<Quaternion<T>>& TransformHierarchy<T>::getLocalRotations() const {
+    return localRotations;
+}
+
+template<typename T>
+const std::vector<Vector3<T>>& TransformHierarchy<T>::getLocalScales() const {
+    return localScales;
+}
+
+template<typename T>
+const std::vector<uint32_t>& TransformHierarchy<T>::getParents() const {
+    return parents;
+}
+
+// Dirty tracking
+
+template<typename T>
+bool TransformHierarchy<T>::isDirty(uint32_t node) const {
+    return dirty[node] != 0;
+}
+
+template<typename T>
+void TransformHierarchy<T>::markDirty(uint32_t node) {
+    if (!dirty[node]) {
+        dirty[node] = 1;
+        ++dirtyCount;
+    }
+}
+
+template<typename T>
+void TransformHierarchy<T>::markAllDirty() {
+    std::fill(dirty.begin(), dirty.end(), 1);
+    dirtyCount = dirty.size();
+}
+
+// World matrices
+
+template<typename T>
+void TransformHierarchy<T>::computeWorldMatrix(uint32_t node) {
+    Matrix4x4<T> local = Transform<T>::buildModelMatrix(localPositions[node], localRotations[node], localScales[node]);
+    uint32_t parent = parents[node];
+    if (parent == NO_PARENT) {
+        worldMatrices[node] = local;
+    } else {
+        multiplyAffine(worldMatrices[parent], local, worldMatrices[node]);
+    }
+}
+
+template<typename T>
+size_t TransformHierarchy<T>::updateWorldMatrices() {
+    if (dirtyCount == 0) {
+        return 0;
+    }
+
+    // Parents precede children, so a parent's flag is final before its children
+    // are visited; recomputed nodes stay flagged to propagate to their subtree
+    size_t first = static_cast<size_t>(std::find(dirty.begin(), dirty.end(), 1) - dirty.begin());
+    size_t updated = 0;
+    for (size_t i = first; i < parents.size(); ++i) {
+        uint32_t parent = parents[i];
+        if (dirty[i] || (parent != NO_PARENT && dirty[parent])) {
+            computeWorldMatrix(static_cast<uint32_t>(i));
+            dirty[i] = 1;
+            ++updated;
+        }
+    }
+
+    std::fill(dirty.begin() + first, dirty.end(), 0);
+    dirtyCount = 0;
+    return updated;
+}
+
+template<typename T>
+size_t TransformHierarchy<T>::updateNodes(const uint32_t* nodes, size_t count) {
+    size_t updated = 0;
+    for (size_t k = 0; k < count; ++k) {
+        uint32_t node = nodes[k];
+        uint32_t parent = parents[node];
+        if (dirty[node] || (parent != NO_PARENT && dirty[parent])) {
+            computeWorldMatrix(node);
+            dirty[node] = 1;
+            ++updated;
+        }
+    }
+    return updated;
+}
+
+template<typename T>
+void TransformHierarchy<T>::rebuildPartition(size_t workers) {
+    partitionWorkers = workers;
+    partitionDirty = false;
+    prefixNodes.clear();
+    bucketNodes.clear();
+    bucketOffsets.assign(1, 0);
+
+    // Subtree sizes in one backward pass, since children follow their parents
+    const uint32_t count = static_cast<uint32_t>(parents.size());
+    std::vector<size_t> subtreeSizes(count, 1);
+    for (uint32_t node = count; node-- > 0;) {
+        if (parents[node] != NO_PARENT) {
+            subtreeSizes[parents[node]] += subtreeSizes[node];
+        }
+    }
+
+    // Nodes grouped by depth, index order kept within each level
+    uint32_t maxDepth = 0;
+    for (uint32_t depth : depths) {
+        maxDepth = std::max(maxDepth, depth);
+    }
+    std::vector<size_t> levelOffsets(maxDepth + 2, 0);
+    for (uint32_t depth : depths) {
+        ++levelOffsets[depth + 1];
+    }
+    for (size_t level = 1; level < levelOffsets.size(); ++level) {
+        levelOffsets[level] += levelOffsets[level - 1];
+    }
+    std::vector<uint32_t> levelNodes(count);
+    std::vector<size_t> cursor(levelOffsets.begin(), levelOffsets.end() - 1);
+    for (uint32_t node = 0; node < count; ++node) {
+        levelNodes[cursor[depths[node]]++] = node;
+    }
+
+    // Pick the split level whose subtrees give the shortest critical path:
+    // the nodes above it, then the heaviest bucket of subtrees below it.
+    // Largest subtrees go first, each to the lightest bucket.
+    auto assign = [&](uint32_t level, std::vector<size_t>& load, std::vector<uint32_t>& roots) {
+        roots.assign(levelNodes.begin() + levelOffsets[level], levelNodes.begin() + levelOffsets[level + 1]);
+        std::sort(roots.begin(), roots.end(), [&](uint32_t a, uint32_t b) {
+            return subtreeSizes[a] > subtreeSizes[b];
+        });
+        load.assign(workers, 0);
+        for (uint32_t root : roots) {
+            *std::min_element(load.begin(), load.end()) += subtreeSizes[root];
+        }
+        return levelOffsets[level] + *std::max_element(load.begin(), load.end());
+    };
+    std::vector<size_t> load;
+    std::vector<uint32_t> roots;
+    uint32_t split = 0;
+    size_t best = count;
+    for (uint32_t level = 0; level <= maxDepth && levelOffsets[level] < best; ++level) {
+        if (levelOffsets[level + 1] - levelOffsets[level] < workers) {
+            continue;
+        }
+        size_t cost = assign(level, load, roots);
+        if (cost < best) {
+            best = cost;
+            split = level;
+        }
+    }
+
+    // Not worth splitting unless the critical path drops to 3/4 of a serial pass
+    if (best * 4 > static_cast<size_t>(count) * 3) {
+        return;
+    }
+
+    assign(split, load, roots);
+    load.assign(workers, 0);
+    std::vector<uint32_t> subtree(count, NO_PARENT);
+    std::vector<uint32_t> bucketOf(count, 0);
+    for (uint32_t root : roots) {
+        size_t lightest = static_cast<size_t>(std::min_element(load.begin(), load.end()) - load.begin());
+        load[lightest] += subtreeSizes[root];
+        bucketOf[root] = static_cast<uint32_t>(lightest);
+    }
+    for (uint32_t node = 0; node < count; ++node) {
+        if (depths[node] == split) {
+            subtree[node] = node;
+        } else if (depths[node] > split) {
+            subtree[node] = subtree[parents[node]];
+        }
+    }
+
+    bucketOffsets.assign(workers + 1, 0);
+    for (size_t bucket = 0; bucket < workers; ++bucket) {
+        bucketOffsets[bucket + 1] = bucketOffsets[bucket] + load[bucket];
+    }
+    bucketNodes.resize(bucketOffsets[workers]);
+    cursor.assign(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for (uint32_t node = 0; node < count; ++node) {
+        if (subtree[node] == NO_PARENT) {
+            prefixNodes.push_back(node);
+        } else {
+            bucketNodes[cursor[bucketOf[subtree[node]]]++] = node;
+        }
+    }
+}
+
+template<typename T>
+size_t TransformHierarchy<T>::updateWorldMatricesParallel(size_t threadCount) {
+    if (dirtyCount == 0) {
+        return 0;
+    }
+
+    // Below this many nodes per worker, thread startup outweighs the work
+    constexpr size_t minPerWorker = 4096;
+    size_t workers = Parallel::workerCount(parents.size(), threadCount, minPerWorker);
+    if (workers <= 1) {
+        return updateWorldMatrices();
+    }
+    if (partitionDirty || partitionWorkers != workers) {
+        rebuildPartition(workers);
+    }
+    if (bucketNodes.empty()) {
+        return updateWorldMatrices();
+    }
+
+    // Subtrees only read flags and matrices inside themselves or from the
+    // prefix, which is final before the workers start
+    size_t updated = updateNodes(prefixNodes.data(), prefixNodes.size());
+    std::atomic<size_t> subtreeUpdated(0);
+    Parallel::forRange(workers, workers, 1, [&](size_t begin, size_t end, size_t) {
+        for (size_t bucket = begin; bucket < end; ++bucket) {
+            subtreeUpdated += updateNodes(bucketNodes.data() + bucketOffsets[bucket],
+                                          bucketOffsets[bucket + 1] - bucketOffsets[bucket]);
+        }
+    });
+
+    std::fill(dirty.begin(), dirty.end(), 0);
+    dirtyCount = 0;
+    return updated + subtreeUpdated.load();
+}
+
+template<typename T>
+uint32_t TransformHierarchy<T>::getDepth(uint32_t node) const {
+    return depths[node];
+}
+
+template<typename T>
+size_t TransformHierarchy<T>::levelCount() const {
+    uint32_t maxDepth = 0;
+    for (uint32_t depth : depths) {
+        maxDepth = std::max(maxDepth, depth);
+    }
+    return parents.empty() ? 0 : maxDepth + 1;
+}
+
+template<typename T>
+const Matrix4x4<T>& TransformHierarchy<T>::getWorldMatrix(uint32_t node) const {
+    return worldMatrices[node];
+}
+
+template<typename T>
+const std::vector<Matrix4x4<T>>& TransformHierarchy<T>::getWorldMatrices() const {
+    return worldMatrices;
+}
+
+template<typename T>
+Transform<T> TransformHierarchy<T>::computeWorldTransform(uint32_t node) const {
+    Transform<T> world = getLocalTransform(node);
+    for (uint32_t parent = parents[node]; parent != NO_PARENT; parent = parents[parent]) {
+        world = getLocalTransform(parent).combine(world);
+    }
+    return world;
+}
+
+// Explicit template instantiations
+template class TransformHierarchy<float>;
+template class TransformHierarchy<double>;
@@ -0,0 +1,150 @@
+#include "../../include/transformations/skinning.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    void validate(const Skinning::VertexStreams& vertices, const Skinning::OutputStreams& out) {
+        size_t count = vertices.positions.size();
+        if (vertices.boneIndices.size() < count * Skinning::INFLUENCES ||
+            vertices.weights.size() < count * Skinning::INFLUENCES) {
+            throw std::invalid_argument("Bone index and weight streams need INFLUENCES entries per vertex");
+        }
+        if (out.x.size() < count || out.y.size() < count || out.z.size() < count) {
+            throw std::invalid_argument("Position output streams are too small");
+        }
+        if (!vertices.normals.empty() &&
+            (vertices.normals.size() < count || out.nx.size() < count || out.ny.size() < count || out.nz.size() < count)) {
+            throw std::invalid_argument("Normal streams are too small");
+        }
+    }
+}
+
+// Linear blend skinning
+
+void Skinning::linearBlend(const VertexStreams& vertices, std::span<const Matrix4x4<float>> bones,
+                           const OutputStreams& out, size_t threadCount) {
+    validate(vertices, out);
+    const bool skinNormals = !vertices.normals.empty();
+
+    Parallel::forRange(vertices.positions.size(), threadCount, 1024, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            const uint32_t* index = &vertices.boneIndices[v * INFLUENCES];
+            const float* weight = &vertices.weights[v * INFLUENCES];
+
+            // Weighted sum of the top three rows of the bone matrices
+            float m[3][4] = {};
+            for (size_t k = 0; k < INFLUENCES; ++k) {
+                float w = weight[k];
+                if (w == 0.0f) {
+                    continue;
+                }
+                const Matrix4x4<float>& bone = bones[index[k]];
+                for (int r = 0; r < 3; ++r) {
+                    m[r][0] += bone.m[r][0] * w;
+                    m[r][1] += bone.m[r][1] * w;
+                    m[r][2] += bone.m[r][2] * w;
+                    m[r][3] += bone.m[r][3] * w;
+                }
+            }
+
+            const Vector3f& p = vertices.positions[v];
+            out.x[v] = m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3];
+            out.y[v] = m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3];
+            out.z[v] = m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3];
+
+            if (skinNormals) {
+                const Vector3f& n = vertices.normals[v];
+                float nx = m[0][0] * n.x + m[0][1] * n.y + m[0][2] * n.z;
+                float ny = m[1][0] * n.x + m[1][1] * n.y + m[1][2] * n.z;
+                float nz = m[2][0] * n.x + m[2][1] * n.y + m[2][2] * n.z;
+                float lengthSq = nx * nx + ny * ny + nz * nz;
+                float invLength = lengthSq > 0.0f ? 1.0f / std::sqrt(lengthSq) : 0.0f;
+                out.nx[v] = nx * invLength;
+                out.ny[v] = ny * invLength;
+                out.nz[v] = nz * invLength;
+            }
+        }
+    });
+}
+
+// Dual quaternion skinning
+
+void Skinning::dualQuaternion(const VertexStreams& vertices, std::span<const DualQuaternion<float>> bones,
+                              const OutputStreams& out, size_t threadCount) {
+    validate(vertices, out);
+    const bool skinNormals = !vertices.normals.empty();
+
+    // Flatten to (real wxyz, dual wxyz) so the inner loop reads plain floats
+    std::vector<float> flat(bones.size() * 8);
+    for (size_t b = 0; b < bones.size(); ++b) {
+        const Quaternion<float>& real = bones[b].getReal();
+        const Quaternion<float>& dual = bones[b].getDual();
+        float* f = &flat[b * 8];
+        f[0] = real.getW(); f[1] = real.getX(); f[2] = real.getY(); f[3] = real.getZ();
+        f[4] = dual.getW(); f[5] = dual.getX(); f[6] = dual.getY(); f[7] = dual.getZ();
+    }
+
+    Parallel::forRange(vertices.positions.size(), threadCount, 1024, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            const uint32_t* index = &vertices.boneIndices[v * INFLUENCES];
+            const float* weight = &vertices.weights[v * INFLUENCES];
+
+            // Blend in the hemisphere of the first influence to take the short path
+            const float* first = &flat[static_cast<size_t>(index[0]) * 8];
+            float q[8] = {};
+            for (size_t k = 0; k < INFLUENCES; ++k) {
+                float w = weight[k];
+                if (w == 0.0f) {
+                    continue;
+                }
+                const float* b = &flat[static_cast<size_t>(index[k]) * 8];
+                if (b[0] * first[0] + b[1] * first[1] + b[2] * first[2] + b[3] * first[3] < 0.0f) {
+                    w = -w;
+                }
+                for (int c = 0; c < 8; ++c) {
+                    q[c] += b[c] * w;
+                }
+            }
+
+            float lengthSq = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+            float invLength = lengthSq > 0.0f ? 1.0f / std::sqrt(lengthSq) : 0.0f;
+            float rw = q[0] * invLength, rx = q[1] * invLength, ry = q[2] * invLength, rz = q[3] * invLength;
+            float dw = q[4] * invLength, dx = q[5] * invLength, dy = q[6] * invLength, dz = q[7] * invLength;
+
+            // Translation 2 * (rw * d - dw * r + r x d)
+            float tx = 2.0f * (rw * dx - dw * rx + ry * dz - rz * dy);
+            float ty = 2.0f * (rw * dy - dw * ry + rz * dx - rx * dz);
+            float tz = 2.0f * (rw * dz - dw * rz + rx * dy - ry * dx);
+
+            // Rotation p + 2 * r x (r x p + rw * p)
+            auto rotate = [&](const Vector3f& p, float& ox, float& oy, float& oz) {
+                float cx = ry * p.z - rz * p.y + rw * p.x;
+                float cy = rz * p.x - rx * p.z + rw * p.y;
+                float cz = rx * p.y - ry * p.x + rw * p.z;
+                ox = p.x + 2.0f * (ry * cz - rz * cy);
+                oy = p.y + 2.0f * (rz * cx - rx * cz);
+                oz = p.z + 2.0f * (rx * cy - ry * cx);
+            };
+
+            float px, py, pz;
+            rotate(vertices.positions[v], px, py, pz);
+            out.x[v] = px + tx;
+            out.y[v] = py + ty;
+            out.z[v] = pz + tz;
+
+            if (skinNormals) {
+                rotate(vertices.normals[v], out.nx[v], out.ny[v], out.nz[v]);
+            }
+        }
+    });
+}
+
+void Skinning::toDualQuaternions(std::span<const Matrix4x4<float>> matrices, std::span<DualQuaternion<float>> out) {
+    size_t count = std::min(matrices.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = DualQuaternion<float>::fromMatrix(matrices[i]);
+    }
+}
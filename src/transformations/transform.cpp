@@ -1,4 +1,5 @@
 #include "../../include/transformations/transform.hpp"
+#include <algorithm>
 
 // Constructors
 
@@ -9,6 +10,139 @@ template<typename T>
 Transform<T>::Transform(const Vector3<T>& pos, const Quaternion<T>& rot, const Vector3<T>& scl)
     : position(pos), rotation(rot), scale(scl) {}
 
+// Model matrices
+
+template<typename T>
+Matrix4x4<T> Transform<T>::buildModelMatrix(const Vector3<T>& position,
+                                            const Quaternion<T>& rotation,
+                                            const Vector3<T>& scale) {
+    T x = rotation.getX(), y = rotation.getY(), z = rotation.getZ(), w = rotation.getW();
+    T xx = x * x, yy = y * y, zz = z * z;
+    T xy = x * y, xz = x * z, yz = y * z;
+    T wx = w * x, wy = w * y, wz = w * z;
+    
+    // Rotation columns scaled by the matching scale component
+    return Matrix4x4<T>(
+        (1 - 2 * (yy + zz)) * scale.x, 2 * (xy - wz) * scale.y, 2 * (xz + wy) * scale.z, position.x,
+        2 * (xy + wz) * scale.x, (1 - 2 * (xx + zz)) * scale.y, 2 * (yz - wx) * scale.z, position.y,
+        2 * (xz - wy) * scale.x, 2 * (yz + wx) * scale.y, (1 - 2 * (xx + yy)) * scale.z, position.z,
+        0, 0, 0, 1
+    );
+}
+
+template<typename T>
+Matrix4x4<T> Transform<T>::buildInverseModelMatrix(const Vector3<T>& position,
+                                                   const Quaternion<T>& rotation,
+                                                   const Vector3<T>& scale) {
+    T x = rotation.getX(), y = rotation.getY(), z = rotation.getZ(), w = rotation.getW();
+    T xx = x * x, yy = y * y, zz = z * z;
+    T xy = x * y, xz = x * z, yz = y * z;
+    T wx = w * x, wy = w * y, wz = w * z;
+    T ix = 1 / scale.x, iy = 1 / scale.y, iz = 1 / scale.z;
+    
+    // S^-1 * R^T: transposed rotation rows scaled by the inverse scale
+    T m00 = (1 - 2 * (yy + zz)) * ix, m01 = 2 * (xy + wz) * ix, m02 = 2 * (xz - wy) * ix;
+    T m10 = 2 * (xy - wz) * iy, m11 = (1 - 2 * (xx + zz)) * iy, m12 = 2 * (yz + wx) * iy;
+    T m20 = 2 * (xz + wy) * iz, m21 = 2 * (yz - wx) * iz, m22 = (1 - 2 * (xx + yy)) * iz;
+    
+    return Matrix4x4<T>(
+        m00, m01, m02, -(m00 * position.x + m01 * position.y + m02 * position.z),
+        m10, m11, m12, -(m10 * position.x + m11 * position.y + m12 * position.z),
+        m20, m21, m22, -(m20 * position.x + m21 * position.y + m22 * position.z),
+        0, 0, 0, 1
+    );
+}
+
+template<typename T>
+void Transform<T>::buildModelMatrices(std::span<const Transform<T>> transforms, std::span<Matrix4x4<T>> out) {
+    size_t count = std::min(transforms.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        const Transform<T>& t = transforms[i];
+        out[i] = buildModelMatrix(t.position, t.rotation, t.scale);
+    }
+}
+
+template<typename T>
+void Transform<T>::buildInverseModelMatrices(std::span<const Transform<T>> transforms, std::span<Matrix4x4<T>> out) {
+    size_t count = std::min(transforms.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        const Transform<T>& t = transforms[i];
+        out[i] = buildInverseModelMatrix(t.position, t.rotation, t.scale);
+    }
+}
+
+// Matrix decomposition
+
+template<typename T>
+Transform<T> Transform<T>::fromModelMatrix(const Matrix4x4<T>& matrix) {
+    Transform<T> result;
+    result.decomposeModelMatrix(matrix);
+    return result;
+}
+
+template<typename T>
+void Transform<T>::decomposeModelMatrix(const Matrix4x4<T>& matrix) {
+    position = Vector3<T>(matrix[0][3], matrix[1][3], matrix[2][3]);
+    
+    Vector3<T> column0(matrix[0][0], matrix[1][0], matrix[2][0]);
+    Vector3<T> column1(matrix[0][1], matrix[1][1], matrix[2][1]);
+    Vector3<T> column2(matrix[0][2], matrix[1][2], matrix[2][2]);
+    scale = Vector3<T>(column0.length(), column1.length(), column2.length());
+    
+    // A negative determinant means one axis is mirrored
+    if (column0.cross(column1).dot(column2) < 0) {
+        scale.x = -scale.x;
+    }
+    
+    Vector3<T> x = scale.x != 0 ? column0 / scale.x : Vector3<T>(1, 0, 0);
+    Vector3<T> y = scale.y != 0 ? column1 / scale.y : Vector3<T>(0, 1, 0);
+    Vector3<T> z = scale.z != 0 ? column2 / scale.z : Vector3<T>(0, 0, 1);
+    rotation = Quaternion<T>::fromRotation(x.x, y.x, z.x,
+                                           x.y, y.y, z.y,
+                                           x.z, y.z, z.z).normalized();
+}
+
+template<typename T>
+void Transform<T>::decomposeModelMatrices(std::span<const Matrix4x4<T>> matrices, std::span<Transform<T>> out) {
+    size_t count = std::min(matrices.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        out[i].decomposeModelMatrix(matrices[i]);
+    }
+}
+
+template<typename T>
+Transform<T> Transform<T>::fromModelMatrixPolar(const Matrix4x4<T>& matrix) {
+    Matrix3x3<T> linear(matrix[0][0], matrix[0][1], matrix[0][2],
+                        matrix[1][0], matrix[1][1], matrix[1][2],
+                        matrix[2][0], matrix[2][1], matrix[2][2]);
+    
+    // Mirror the x axis first so the orthogonal factor is a proper rotation
+    bool mirrored = linear.determinant() < 0;
+    if (mirrored) {
+        linear(0, 0) = -linear(0, 0);
+        linear(1, 0) = -linear(1, 0);
+        linear(2, 0) = -linear(2, 0);
+    }
+    
+    Matrix3x3<T> rotationMat, stretch;
+    linear.polarDecompose(rotationMat, stretch);
+    
+    Vector3<T> scale(stretch(0, 0), stretch(1, 1), stretch(2, 2));
+    if (mirrored) {
+        scale.x = -scale.x;
+    }
+    return Transform<T>(Vector3<T>(matrix[0][3], matrix[1][3], matrix[2][3]),
+                        Quaternion<T>::fromMatrix(rotationMat).normalized(), scale);
+}
+
+template<typename T>
+void Transform<T>::decomposeModelMatricesPolar(std::span<const Matrix4x4<T>> matrices, std::span<Transform<T>> out) {
+    size_t count = std::min(matrices.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = fromModelMatrixPolar(matrices[i]);
+    }
+}
+
 // Combining transforms
 
 template<typename T>
@@ -31,6 +165,15 @@ Transform<T> Transform<T>::lerp(const Transform<T>& a, const Transform<T>& b, T
     return Transform<T>(position, rotation, scale);
 }
 
+template<typename T>
+Transform<T> Transform<T>::slerp(const Transform<T>& a, const Transform<T>& b, T t) {
+    Vector3<T> position = Vector3<T>::lerp(a.position, b.position, t);
+    Quaternion<T> rotation = Quaternion<T>::slerp(a.rotation, b.rotation, t);
+    Vector3<T> scale = Vector3<T>::lerp(a.scale, b.scale, t);
+    
+    return Transform<T>(position, rotation, scale);
+}
+
 // Getters and setters
 
 template<typename T>
@@ -96,3 +239,7 @@ template<typename T>
 Vector3<T> Transform<T>::right() const {
     return rotation.rotate(Vector3<T>(1, 0, 0));
 }
+
+// Explicit template instantiations
+template class Transform<float>;
+template class Transform<double>;
@@ -0,0 +1,163 @@
+#include "../../include/utilities/bakedcurve.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    // Weighted sum form, so types like Color that clamp on subtraction blend correctly
+    template<typename T>
+    inline T blend(const T& a, const T& b, float t) {
+        return a * (1.0f - t) + b * t;
+    }
+
+    // Clamps a table position to [0, last] with NaN mapped to 0, so the index stays in bounds
+    inline float clampPosition(float position, float last) {
+        return !(position > 0.0f) ? 0.0f : std::min(position, last);
+    }
+}
+
+// Construction
+
+template<typename T>
+BakedCurve<T>::BakedCurve() : values(2, T()), start(0.0f), scale(0.0f) {}
+
+template<typename T>
+BakedCurve<T>::BakedCurve(const std::function<T(float)>& curve, size_t resolution, float start, float end)
+    : start(start), scale(0.0f) {
+    bake(curve, resolution, start, end);
+}
+
+template<typename T>
+void BakedCurve<T>::bake(const std::function<T(float)>& curve, size_t resolution, float start, float end) {
+    if (resolution < 2) {
+        throw std::invalid_argument("Baked curve needs at least 2 samples");
+    }
+    if (!(end > start)) {
+        throw std::invalid_argument("Baked curve range must have end > start");
+    }
+    if (!curve) {
+        throw std::invalid_argument("Baked curve needs a curve to sample");
+    }
+    values.resize(resolution + 1);
+    const float step = (end - start) / static_cast<float>(resolution - 1);
+    for (size_t i = 0; i < resolution; ++i) {
+        values[i] = curve(i + 1 == resolution ? end : start + step * static_cast<float>(i));
+    }
+    values[resolution] = values[resolution - 1];
+    this->start = start;
+    scale = static_cast<float>(resolution - 1) / (end - start);
+}
+
+// Lookup
+
+template<typename T>
+T BakedCurve<T>::sample(float x) const {
+    float position = clampPosition((x - start) * scale, static_cast<float>(values.size() - 2));
+    size_t i = static_cast<size_t>(position);
+    return blend(values[i], values[i + 1], position - static_cast<float>(i));
+}
+
+template<typename T>
+T BakedCurve<T>::operator()(float x) const {
+    return sample(x);
+}
+
+template<typename T>
+void BakedCurve<T>::sample(std::span<const float> x, std::span<T> out) const {
+    const size_t count = std::min(x.size(), out.size());
+    const T* table = values.data();
+    const float last = static_cast<float>(values.size() - 2);
+    for (size_t k = 0; k < count; ++k) {
+        float position = clampPosition((x[k] - start) * scale, last);
+        size_t i = static_cast<size_t>(position);
+        out[k] = blend(table[i], table[i + 1], position - static_cast<float>(i));
+    }
+}
+
+template<typename T>
+void BakedCurve<T>::sample(std::span<const float> ages, std::span<const float> lifetimes, std::span<T> out) const {
+    const size_t count = std::min({ ages.size(), lifetimes.size(), out.size() });
+    const T* table = values.data();
+    const float last = static_cast<float>(values.size() - 2);
+    for (size_t k = 0; k < count; ++k) {
+        float x = lifetimes[k] > 0.0f ? ages[k] / lifetimes[k] : 1.0f;
+        float position = clampPosition((x - start) * scale, last);
+        size_t i = static_cast<size_t>(position);
+        out[k] = blend(table[i], table[i + 1], position - static_cast<float>(i));
+    }
+}
+
+// Properties
+
+template<typename T>
+size_t BakedCurve<T>::resolution() const {
+    return values.size() - 1;
+}
+
+template<typename T>
+float BakedCurve<T>::getStart() const {
+    return start;
+}
+
+template<typename T>
+float BakedCurve<T>::getEnd() const {
+    return scale > 0.0f ? start + static_cast<float>(values.size() - 2) / scale : start;
+}
+
+template<typename T>
+const std::vector<T>& BakedCurve<T>::getValues() const {
+    return values;
+}
+
+// Bakers
+
+BakedCurve<float> CurveBaking::bakeEase(Interpolation::EaseType type, float from, float to, size_t resolution) {
+    return BakedCurve<float>([=](float t) { return from + (to - from) * Interpolation::ease(t, type); }, resolution);
+}
+
+template<typename T>
+BakedCurve<T> CurveBaking::bakeBezier(const T& p0, const T& p1, const T& p2, const T& p3, size_t resolution) {
+    return BakedCurve<T>([&](float t) { return Interpolation::bezier(p0, p1, p2, p3, t); }, resolution);
+}
+
+template<typename T>
+BakedCurve<T> CurveBaking::bakePath(const Path<T>& path, size_t resolution) {
+    return BakedCurve<T>([&](float t) { return path.sample(t); }, resolution);
+}
+
+BakedCurve<Color> CurveBaking::bakeGradient(std::span<const GradientStop> stops, size_t resolution) {
+    if (stops.empty()) {
+        throw std::invalid_argument("Gradient needs at least one stop");
+    }
+    auto byPosition = [](const GradientStop& a, const GradientStop& b) { return a.position < b.position; };
+    if (!std::is_sorted(stops.begin(), stops.end(), byPosition)) {
+        throw std::invalid_argument("Gradient stops must be sorted by position");
+    }
+    return BakedCurve<Color>([&](float t) {
+        // First stop past t; equal positions make a hard edge at t
+        size_t next = static_cast<size_t>(std::upper_bound(stops.begin(), stops.end(), t,
+            [](float value, const GradientStop& stop) { return value < stop.position; }) - stops.begin());
+        if (next == 0) {
+            return stops.front().color;
+        }
+        if (next == stops.size()) {
+            return stops.back().color;
+        }
+        const GradientStop& a = stops[next - 1];
+        const GradientStop& b = stops[next];
+        float span = b.position - a.position;
+        return Color::lerp(a.color, b.color, span > 0.0f ? (t - a.position) / span : 1.0f);
+    }, resolution);
+}
+
+// Explicit template instantiations
+template class BakedCurve<float>;
+template class BakedCurve<Vector2f>;
+template class BakedCurve<Vector3f>;
+template class BakedCurve<Vector4f>;
+template class BakedCurve<Color>;
+
+template BakedCurve<float> CurveBaking::bakeBezier<float>(const float&, const float&, const float&, const float&, size_t);
+template BakedCurve<Vector2f> CurveBaking::bakeBezier<Vector2f>(const Vector2f&, const Vector2f&, const Vector2f&, const Vector2f&, size_t);
+template BakedCurve<Vector3f> CurveBaking::bakeBezier<Vector3f>(const Vector3f&, const Vector3f&, const Vector3f&, const Vector3f&, size_t);
+template BakedCurve<Vector2f> CurveBaking::bakePath<Vector2f>(const Path<Vector2f>&, size_t);
+template BakedCurve<Vector3f> CurveBaking::bakePath<Vector3f>(const Path<Vector3f>&, size_t);
@@ -0,0 +1,179 @@
+#include "../../include/utilities/bvh.hpp"
+#include "../../include/utilities/intersection.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include <algorithm>
+
+namespace {
+    float distanceSquaredToBox(const Vector3f& point, const AABBf& box) {
+        float dx = std::max(std::max(box.min.x - point.x, point.x - box.max.x), 0.0f);
+        float dy = std::max(std::max(box.min.y - point.y, point.y - box.max.y), 0.0f);
+        float dz = std::max(std::max(box.min.z - point.z, point.z - box.max.z), 0.0f);
+        return dx * dx + dy * dy + dz * dz;
+    }
+}
+
+// Construction
+
+MeshBVH::MeshBVH() {}
+
+MeshBVH::MeshBVH(std::span<const Vector3f> vertices, std::span<const uint32_t> indices) {
+    build(vertices, indices);
+}
+
+void MeshBVH::build(std::span<const Vector3f> vertices, std::span<const uint32_t> indices) {
+    nodes.clear();
+    corners.clear();
+    triangleIds.clear();
+
+    uint32_t count = static_cast<uint32_t>(indices.size() / 3);
+    if (count == 0) {
+        return;
+    }
+
+    std::vector<uint32_t> order(count);
+    std::vector<Vector3f> centroids(count);
+    std::vector<AABBf> boxes(count);
+    for (uint32_t t = 0; t < count; ++t) {
+        const Vector3f& a = vertices[indices[t * 3]];
+        const Vector3f& b = vertices[indices[t * 3 + 1]];
+        const Vector3f& c = vertices[indices[t * 3 + 2]];
+        order[t] = t;
+        centroids[t] = (a + b + c) / 3.0f;
+        boxes[t] = AABBf(a, a);
+        boxes[t].expand(b);
+        boxes[t].expand(c);
+    }
+
+    nodes.reserve(2 * count / MAX_LEAF_TRIANGLES + 1);
+    buildRecursive(order, centroids, boxes, 0, count);
+
+    triangleIds = order;
+    corners.resize(static_cast<size_t>(count) * 3);
+    for (uint32_t t = 0; t < count; ++t) {
+        for (uint32_t k = 0; k < 3; ++k) {
+            corners[t * 3 + k] = vertices[indices[order[t] * 3 + k]];
+        }
+    }
+}
+
+uint32_t MeshBVH::buildRecursive(std::vector<uint32_t>& order, std::vector<Vector3f>& centroids,
+                                 std::vector<AABBf>& boxes, uint32_t begin, uint32_t end) {
+    uint32_t nodeIndex = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(Node{ boxes[order[begin]], begin, end - begin });
+
+    AABBf centroidBounds(centroids[order[begin]], centroids[order[begin]]);
+    for (uint32_t i = begin; i < end; ++i) {
+        nodes[nodeIndex].bounds.expand(boxes[order[i]]);
+        centroidBounds.expand(centroids[order[i]]);
+    }
+
+    if (end - begin <= MAX_LEAF_TRIANGLES) {
+        return nodeIndex;
+    }
+
+    // Median split along the longest axis of the centroid bounds
+    Vector3f size = centroidBounds.size();
+    int axis = (size.x > size.y && size.x > size.z) ? 0 : (size.y > size.z ? 1 : 2);
+    auto key = [&](uint32_t t) {
+        const Vector3f& c = centroids[t];
+        return axis == 0 ? c.x : (axis == 1 ? c.y : c.z);
+    };
+    uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                     [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+
+    buildRecursive(order, centroids, boxes, begin, mid);
+    uint32_t right = buildRecursive(order, centroids, boxes, mid, end);
+    nodes[nodeIndex].first = right;
+    nodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+// Properties
+
+const std::vector<MeshBVH::Node>& MeshBVH::getNodes() const {
+    return nodes;
+}
+
+size_t MeshBVH::triangleCount() const {
+    return triangleIds.size();
+}
+
+AABBf MeshBVH::getBounds() const {
+    return nodes.empty() ? AABBf() : nodes[0].bounds;
+}
+
+void MeshBVH::getTriangle(uint32_t triangle, Vector3f& a, Vector3f& b, Vector3f& c) const {
+    a = corners[triangle * 3];
+    b = corners[triangle * 3 + 1];
+    c = corners[triangle * 3 + 2];
+}
+
+uint32_t MeshBVH::originalIndex(uint32_t triangle) const {
+    return triangleIds[triangle];
+}
+
+// Queries
+
+MeshBVH::ClosestHit MeshBVH::closestPointOnMesh(const Vector3f& point, float maxDistance) const {
+    ClosestHit hit;
+    if (nodes.empty()) {
+        return hit;
+    }
+
+    float bestSquared = maxDistance < std::numeric_limits<float>::max()
+        ? maxDistance * maxDistance : std::numeric_limits<float>::max();
+
+    uint32_t stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (distanceSquaredToBox(point, node.bounds) > bestSquared) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint32_t t = node.first; t < node.first + node.count; ++t) {
+                const Vector3f* tri = &corners[t * 3];
+                Vector3f closest = Intersection::closestPointTriangle(point, tri[0], tri[1], tri[2]);
+                Vector3f delta = point - closest;
+                float distanceSquared = delta.dot(delta);
+                if (distanceSquared <= bestSquared) {
+                    bestSquared = distanceSquared;
+                    hit.point = closest;
+                    hit.triangle = triangleIds[t];
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first by pushing it last
+        uint32_t left = static_cast<uint32_t>(&node - nodes.data()) + 1;
+        uint32_t right = node.first;
+        float leftDistance = distanceSquaredToBox(point, nodes[left].bounds);
+        float rightDistance = distanceSquaredToBox(point, nodes[right].bounds);
+        if (leftDistance < rightDistance) {
+            std::swap(left, right);
+            std::swap(leftDistance, rightDistance);
+        }
+        if (leftDistance <= bestSquared) stack[top++] = left;
+        if (rightDistance <= bestSquared) stack[top++] = right;
+    }
+
+    if (hit.found()) {
+        hit.distance = std::sqrt(bestSquared);
+    }
+    return hit;
+}
+
+void MeshBVH::closestPointsOnMesh(std::span<const Vector3f> points, std::span<ClosestHit> hits,
+                                  float maxDistance, size_t threadCount) const {
+    size_t count = std::min(points.size(), hits.size());
+    Parallel::forRange(count, threadCount, 256, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i] = closestPointOnMesh(points[i], maxDistance);
+        }
+    });
+}
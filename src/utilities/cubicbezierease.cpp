@@ -0,0 +1,155 @@
+#include "../../include/utilities/cubicbezierease.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr int NEWTON_ITERATIONS = 4;
+    constexpr float NEWTON_MIN_SLOPE = 1e-3f;
+    constexpr float NEWTON_PRECISION = 1e-6f;
+    constexpr float BISECTION_PRECISION = 1e-7f;
+    constexpr int BISECTION_ITERATIONS = 24;
+    constexpr float SAMPLE_STEP = 1.0f / (CubicBezierEase::SAMPLE_COUNT - 1);
+}
+
+// Construction
+
+CubicBezierEase::CubicBezierEase() : CubicBezierEase(0.0f, 0.0f, 1.0f, 1.0f) {}
+
+CubicBezierEase::CubicBezierEase(float x1, float y1, float x2, float y2)
+    : x1(x1), y1(y1), x2(x2), y2(y2) {
+    if (!(x1 >= 0.0f && x1 <= 1.0f && x2 >= 0.0f && x2 <= 1.0f)) {
+        throw std::invalid_argument("Cubic bezier x values must be in [0, 1]");
+    }
+    cx = 3.0f * x1;
+    bx = 3.0f * (x2 - x1) - cx;
+    ax = 1.0f - cx - bx;
+    cy = 3.0f * y1;
+    by = 3.0f * (y2 - y1) - cy;
+    ay = 1.0f - cy - by;
+    linear = x1 == y1 && x2 == y2;
+    for (size_t i = 0; i < SAMPLE_COUNT; ++i) {
+        samples[i] = curveX(static_cast<float>(i) * SAMPLE_STEP);
+    }
+}
+
+CubicBezierEase CubicBezierEase::ease() {
+    return CubicBezierEase(0.25f, 0.1f, 0.25f, 1.0f);
+}
+
+CubicBezierEase CubicBezierEase::easeIn() {
+    return CubicBezierEase(0.42f, 0.0f, 1.0f, 1.0f);
+}
+
+CubicBezierEase CubicBezierEase::easeOut() {
+    return CubicBezierEase(0.0f, 0.0f, 0.58f, 1.0f);
+}
+
+CubicBezierEase CubicBezierEase::easeInOut() {
+    return CubicBezierEase(0.42f, 0.0f, 0.58f, 1.0f);
+}
+
+// Curve
+
+float CubicBezierEase::curveX(float s) const {
+    return ((ax * s + bx) * s + cx) * s;
+}
+
+float CubicBezierEase::curveY(float s) const {
+    return ((ay * s + by) * s + cy) * s;
+}
+
+float CubicBezierEase::slopeX(float s) const {
+    return (3.0f * ax * s + 2.0f * bx) * s + cx;
+}
+
+float CubicBezierEase::solveParameter(float x) const {
+    // Sample interval containing x, then a linear guess inside it
+    size_t i = 1;
+    while (i < SAMPLE_COUNT - 1 && samples[i] <= x) {
+        ++i;
+    }
+    --i;
+    float lower = static_cast<float>(i) * SAMPLE_STEP;
+    float upper = lower + SAMPLE_STEP;
+    float width = samples[i + 1] - samples[i];
+    float s = lower + (width > 0.0f ? (x - samples[i]) / width : 0.0f) * SAMPLE_STEP;
+
+    // Newton from the guess; keep the result only if it actually converged
+    if (slopeX(s) >= NEWTON_MIN_SLOPE) {
+        float guess = s;
+        for (int k = 0; k < NEWTON_ITERATIONS; ++k) {
+            float slope = slopeX(guess);
+            if (slope == 0.0f) {
+                break;
+            }
+            guess -= (curveX(guess) - x) / slope;
+        }
+        if (guess >= lower && guess <= upper && std::abs(curveX(guess) - x) <= NEWTON_PRECISION) {
+            return guess;
+        }
+    }
+
+    // x(s) is monotonic within the sample interval
+    for (int k = 0; k < BISECTION_ITERATIONS; ++k) {
+        s = 0.5f * (lower + upper);
+        float error = curveX(s) - x;
+        if (std::abs(error) <= BISECTION_PRECISION) {
+            break;
+        }
+        if (error > 0.0f) {
+            upper = s;
+        } else {
+            lower = s;
+        }
+    }
+    return s;
+}
+
+// Evaluation
+
+float CubicBezierEase::evaluate(float t) const {
+    t = std::clamp(t, 0.0f, 1.0f);
+    if (linear) {
+        return t;
+    }
+    if (t == 0.0f || t == 1.0f) {
+        return t;
+    }
+    return curveY(solveParameter(t));
+}
+
+float CubicBezierEase::operator()(float t) const {
+    return evaluate(t);
+}
+
+void CubicBezierEase::evaluate(std::span<const float> t, std::span<float> out) const {
+    const size_t count = std::min(t.size(), out.size());
+    if (linear) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::clamp(t[i], 0.0f, 1.0f);
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = evaluate(t[i]);
+    }
+}
+
+// Properties
+
+float CubicBezierEase::getX1() const {
+    return x1;
+}
+
+float CubicBezierEase::getY1() const {
+    return y1;
+}
+
+float CubicBezierEase::getX2() const {
+    return x2;
+}
+
+float CubicBezierEase::getY2() const {
+    return y2;
+}
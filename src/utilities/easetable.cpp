@@ -0,0 +1,143 @@
+#include "../../include/utilities/easetable.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Catmull-Rom segment between p1 and p2
+    inline float cubicBlend(float p0, float p1, float p2, float p3, float f) {
+        return p1 + 0.5f * f * ((p2 - p0) + f * ((2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) + f * (3.0f * (p1 - p2) + p3 - p0)));
+    }
+
+    // Clamps t to [0, 1] with NaN mapped to 0, so the table index stays in bounds
+    inline float clampUnit(float t) {
+        return !(t > 0.0f) ? 0.0f : std::min(t, 1.0f);
+    }
+}
+
+// Construction
+
+EaseTable::EaseTable() : scale(0.0f), reconstruction(Reconstruction::Linear) {
+    bake(Interpolation::EaseType::Linear, 2);
+}
+
+EaseTable::EaseTable(Interpolation::EaseType type, size_t size, Reconstruction reconstruction)
+    : scale(0.0f), reconstruction(reconstruction) {
+    bake(type, size, reconstruction);
+}
+
+EaseTable::EaseTable(const std::function<float(float)>& function, size_t size, Reconstruction reconstruction)
+    : scale(0.0f), reconstruction(reconstruction) {
+    bake(function, size, reconstruction);
+}
+
+void EaseTable::bake(Interpolation::EaseType type, size_t size, Reconstruction reconstruction) {
+    if (size < 2) {
+        throw std::invalid_argument("Ease table needs at least 2 samples");
+    }
+    std::vector<float> t(size);
+    for (size_t i = 0; i < size; ++i) {
+        t[i] = static_cast<float>(i) / static_cast<float>(size - 1);
+    }
+    values.resize(size + 2);
+    Interpolation::easeBatch(type, t, std::span<float>(values).subspan(1, size));
+    values[0] = 2.0f * values[1] - values[2];
+    values[size + 1] = 2.0f * values[size] - values[size - 1];
+    scale = static_cast<float>(size - 1);
+    this->reconstruction = reconstruction;
+}
+
+void EaseTable::bake(const std::function<float(float)>& function, size_t size, Reconstruction reconstruction) {
+    if (size < 2) {
+        throw std::invalid_argument("Ease table needs at least 2 samples");
+    }
+    if (!function) {
+        throw std::invalid_argument("Ease table needs a function to bake");
+    }
+    values.resize(size + 2);
+    for (size_t i = 0; i < size; ++i) {
+        values[i + 1] = function(static_cast<float>(i) / static_cast<float>(size - 1));
+    }
+    values[0] = 2.0f * values[1] - values[2];
+    values[size + 1] = 2.0f * values[size] - values[size - 1];
+    scale = static_cast<float>(size - 1);
+    this->reconstruction = reconstruction;
+}
+
+EaseTable EaseTable::withTolerance(const std::function<float(float)>& function, float tolerance,
+                                   Reconstruction reconstruction, size_t maxSize) {
+    EaseTable table;
+    for (size_t size = 16; ; size *= 2) {
+        size = std::min(size, std::max<size_t>(maxSize, 2));
+        table.bake(function, size, reconstruction);
+        if (size >= maxSize || table.maxError(function) <= tolerance) {
+            return table;
+        }
+    }
+}
+
+EaseTable EaseTable::withTolerance(Interpolation::EaseType type, float tolerance,
+                                   Reconstruction reconstruction, size_t maxSize) {
+    return withTolerance([type](float t) { return Interpolation::ease(t, type); }, tolerance, reconstruction, maxSize);
+}
+
+// Lookup
+
+float EaseTable::sample(float t) const {
+    float x = clampUnit(t) * scale;
+    float index = std::min(std::floor(x), scale - 1.0f);
+    float f = x - index;
+    const float* p = values.data() + static_cast<size_t>(index);
+    if (reconstruction == Reconstruction::Cubic) {
+        return cubicBlend(p[0], p[1], p[2], p[3], f);
+    }
+    return p[1] + (p[2] - p[1]) * f;
+}
+
+float EaseTable::operator()(float t) const {
+    return sample(t);
+}
+
+void EaseTable::sample(std::span<const float> t, std::span<float> out) const {
+    const size_t count = std::min(t.size(), out.size());
+    const float* table = values.data();
+    const float last = scale - 1.0f;
+
+    // Separate loops per reconstruction keep each one branch-free
+    if (reconstruction == Reconstruction::Cubic) {
+        for (size_t i = 0; i < count; ++i) {
+            float x = clampUnit(t[i]) * scale;
+            float index = std::min(std::floor(x), last);
+            float f = x - index;
+            const float* p = table + static_cast<size_t>(index);
+            out[i] = cubicBlend(p[0], p[1], p[2], p[3], f);
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            float x = clampUnit(t[i]) * scale;
+            float index = std::min(std::floor(x), last);
+            float f = x - index;
+            const float* p = table + static_cast<size_t>(index);
+            out[i] = p[1] + (p[2] - p[1]) * f;
+        }
+    }
+}
+
+float EaseTable::maxError(const std::function<float(float)>& function, size_t samples) const {
+    float error = 0.0f;
+    for (size_t i = 0; i <= samples; ++i) {
+        float t = static_cast<float>(i) / static_cast<float>(samples);
+        error = std::max(error, std::abs(sample(t) - function(t)));
+    }
+    return error;
+}
+
+// Properties
+
+size_t EaseTable::size() const {
+    return values.size() - 2;
+}
+
+EaseTable::Reconstruction EaseTable::getReconstruction() const {
+    return reconstruction;
+}
@@ -0,0 +1,491 @@
+#include "../../include/utilities/grid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Bits of a tile coordinate spread apart for Z-order interleaving
+    constexpr uint32_t SPREAD_2D[8] = { 0, 1, 4, 5, 16, 17, 20, 21 };
+    constexpr uint32_t SPREAD_3D[4] = { 0, 1, 8, 9 };
+
+    int tileCount(int size, int block) {
+        return (size + block - 1) / block;
+    }
+
+    // Node pair and weight along one axis. NaN maps to node 0, and so does
+    // infinity when wrapping, since converting either to int is undefined.
+    void locateAxis(float local, int size, GridAddress address, int& i0, int& i1, float& t) {
+        if (address == GridAddress::Wrap) {
+            // fmod is exact, so even huge inputs land in (-size, size)
+            float n = static_cast<float>(size);
+            local = std::isfinite(local) ? std::fmod(local, n) : 0.0f;
+            if (local < 0.0f) {
+                local += n;
+            }
+            i0 = std::min(static_cast<int>(local), size - 1);
+            i1 = i0 + 1 == size ? 0 : i0 + 1;
+            t = local - static_cast<float>(i0);
+        } else {
+            local = !(local > 0.0f) ? 0.0f : std::min(local, static_cast<float>(size - 1));
+            i0 = std::min(static_cast<int>(local), size - 2);
+            i1 = i0 + 1;
+            t = local - static_cast<float>(i0);
+        }
+    }
+
+    template<typename T>
+    T lerp(T a, T b, float t) {
+        return a + (b - a) * static_cast<T>(t);
+    }
+
+    // Node offsets for each layout; tiles are 8 x 8 in 2D and 4 x 4 x 4 in 3D
+    template<GridLayout Layout>
+    inline size_t nodeIndex(int x, int y, int width, int tilesX) {
+        const uint32_t ux = static_cast<uint32_t>(x), uy = static_cast<uint32_t>(y);
+        if constexpr (Layout == GridLayout::Linear) {
+            return static_cast<size_t>(uy) * width + ux;
+        } else {
+            size_t tile = static_cast<size_t>(uy >> 3) * tilesX + (ux >> 3);
+            if constexpr (Layout == GridLayout::Blocked) {
+                return (tile << 6) + ((uy & 7) << 3) + (ux & 7);
+            } else {
+                return (tile << 6) + (SPREAD_2D[ux & 7] | (SPREAD_2D[uy & 7] << 1));
+            }
+        }
+    }
+
+    template<GridLayout Layout>
+    inline size_t nodeIndex(int x, int y, int z, int width, int height, int tilesX, int tilesY) {
+        const uint32_t ux = static_cast<uint32_t>(x), uy = static_cast<uint32_t>(y), uz = static_cast<uint32_t>(z);
+        if constexpr (Layout == GridLayout::Linear) {
+            return (static_cast<size_t>(uz) * height + uy) * width + ux;
+        } else {
+            size_t tile = (static_cast<size_t>(uz >> 2) * tilesY + (uy >> 2)) * tilesX + (ux >> 2);
+            if constexpr (Layout == GridLayout::Blocked) {
+                return (tile << 6) + ((uz & 3) << 4) + ((uy & 3) << 2) + (ux & 3);
+            } else {
+                return (tile << 6) + (SPREAD_3D[ux & 3] | (SPREAD_3D[uy & 3] << 1) | (SPREAD_3D[uz & 3] << 2));
+            }
+        }
+    }
+}
+
+// Grid2D
+
+template<typename T>
+Grid2D<T>::Grid2D()
+    : width(0), height(0), tilesX(0), layout(GridLayout::Linear), address(GridAddress::Clamp), cellSize(1.0f) {}
+
+template<typename T>
+Grid2D<T>::Grid2D(int width, int height, GridLayout layout, float cellSize, const Vector2f& origin)
+    : width(width), height(height), tilesX(tileCount(width, BLOCK)), layout(layout),
+      address(GridAddress::Clamp), cellSize(cellSize), origin(origin) {
+    if (width < 2 || height < 2) {
+        throw std::invalid_argument("Grid needs at least 2 nodes per axis");
+    }
+    if (cellSize <= 0.0f) {
+        throw std::invalid_argument("Grid cell size must be positive");
+    }
+    size_t count = layout == GridLayout::Linear
+        ? static_cast<size_t>(width) * height
+        : static_cast<size_t>(tilesX) * tileCount(height, BLOCK) * BLOCK * BLOCK;
+    values.assign(count, T());
+}
+
+template<typename T>
+int Grid2D<T>::getWidth() const {
+    return width;
+}
+
+template<typename T>
+int Grid2D<T>::getHeight() const {
+    return height;
+}
+
+template<typename T>
+GridLayout Grid2D<T>::getLayout() const {
+    return layout;
+}
+
+template<typename T>
+float Grid2D<T>::getCellSize() const {
+    return cellSize;
+}
+
+template<typename T>
+const Vector2f& Grid2D<T>::getOrigin() const {
+    return origin;
+}
+
+template<typename T>
+GridAddress Grid2D<T>::getAddressMode() const {
+    return address;
+}
+
+template<typename T>
+void Grid2D<T>::setAddressMode(GridAddress mode) {
+    address = mode;
+}
+
+template<typename T>
+size_t Grid2D<T>::index(int x, int y) const {
+    switch (layout) {
+        case GridLayout::Blocked: return nodeIndex<GridLayout::Blocked>(x, y, width, tilesX);
+        case GridLayout::Morton: return nodeIndex<GridLayout::Morton>(x, y, width, tilesX);
+        default: return nodeIndex<GridLayout::Linear>(x, y, width, tilesX);
+    }
+}
+
+template<typename T>
+T Grid2D<T>::get(int x, int y) const {
+    return values[index(x, y)];
+}
+
+template<typename T>
+void Grid2D<T>::set(int x, int y, T value) {
+    values[index(x, y)] = value;
+}
+
+template<typename T>
+void Grid2D<T>::fill(T value) {
+    std::fill(values.begin(), values.end(), value);
+}
+
+template<typename T>
+void Grid2D<T>::setValues(std::span<const T> source) {
+    if (source.size() != static_cast<size_t>(width) * height) {
+        throw std::invalid_argument("Expected width * height values");
+    }
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            values[index(x, y)] = source[static_cast<size_t>(y) * width + x];
+        }
+    }
+}
+
+template<typename T>
+void Grid2D<T>::getValues(std::span<T> destination) const {
+    if (destination.size() != static_cast<size_t>(width) * height) {
+        throw std::invalid_argument("Expected width * height values");
+    }
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            destination[static_cast<size_t>(y) * width + x] = values[index(x, y)];
+        }
+    }
+}
+
+template<typename T>
+template<GridLayout Layout>
+void Grid2D<T>::locate(const Vector2f& position, T corners[4], float& tx, float& ty) const {
+    int x0, x1, y0, y1;
+    locateAxis((position.x - origin.x) / cellSize, width, address, x0, x1, tx);
+    locateAxis((position.y - origin.y) / cellSize, height, address, y0, y1, ty);
+    corners[0] = values[nodeIndex<Layout>(x0, y0, width, tilesX)];
+    corners[1] = values[nodeIndex<Layout>(x1, y0, width, tilesX)];
+    corners[2] = values[nodeIndex<Layout>(x0, y1, width, tilesX)];
+    corners[3] = values[nodeIndex<Layout>(x1, y1, width, tilesX)];
+}
+
+template<typename T>
+template<GridLayout Layout>
+T Grid2D<T>::sampleWith(const Vector2f& position) const {
+    T v[4];
+    float tx, ty;
+    locate<Layout>(position, v, tx, ty);
+    return lerp(lerp(v[0], v[1], tx), lerp(v[2], v[3], tx), ty);
+}
+
+template<typename T>
+template<GridLayout Layout>
+Vector2<T> Grid2D<T>::gradientWith(const Vector2f& position) const {
+    T v[4];
+    float tx, ty;
+    locate<Layout>(position, v, tx, ty);
+
+    // Analytic derivative of the bilinear interpolant
+    T scale = static_cast<T>(1) / static_cast<T>(cellSize);
+    return Vector2<T>(lerp(v[1] - v[0], v[3] - v[2], ty) * scale,
+                      lerp(v[2] - v[0], v[3] - v[1], tx) * scale);
+}
+
+template<typename T>
+T Grid2D<T>::sample(const Vector2f& position) const {
+    switch (layout) {
+        case GridLayout::Blocked: return sampleWith<GridLayout::Blocked>(position);
+        case GridLayout::Morton: return sampleWith<GridLayout::Morton>(position);
+        default: return values.empty() ? T() : sampleWith<GridLayout::Linear>(position);
+    }
+}
+
+template<typename T>
+Vector2<T> Grid2D<T>::gradient(const Vector2f& position) const {
+    switch (layout) {
+        case GridLayout::Blocked: return gradientWith<GridLayout::Blocked>(position);
+        case GridLayout::Morton: return gradientWith<GridLayout::Morton>(position);
+        default: return values.empty() ? Vector2<T>() : gradientWith<GridLayout::Linear>(position);
+    }
+}
+
+template<typename T>
+void Grid2D<T>::sample(std::span<const Vector2f> positions, std::span<T> out) const {
+    if (values.empty()) {
+        return;
+    }
+    // Layout chosen once, outside the loop
+    size_t count = std::min(positions.size(), out.size());
+    switch (layout) {
+        case GridLayout::Blocked:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Blocked>(positions[i]);
+            break;
+        case GridLayout::Morton:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Morton>(positions[i]);
+            break;
+        default:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Linear>(positions[i]);
+            break;
+    }
+}
+
+template<typename T>
+void Grid2D<T>::gradient(std::span<const Vector2f> positions, std::span<Vector2<T>> out) const {
+    if (values.empty()) {
+        return;
+    }
+    size_t count = std::min(positions.size(), out.size());
+    switch (layout) {
+        case GridLayout::Blocked:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Blocked>(positions[i]);
+            break;
+        case GridLayout::Morton:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Morton>(positions[i]);
+            break;
+        default:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Linear>(positions[i]);
+            break;
+    }
+}
+
+// Grid3D
+
+template<typename T>
+Grid3D<T>::Grid3D()
+    : width(0), height(0), depth(0), tilesX(0), tilesY(0), layout(GridLayout::Linear),
+      address(GridAddress::Clamp), cellSize(1.0f) {}
+
+template<typename T>
+Grid3D<T>::Grid3D(int width, int height, int depth, GridLayout layout, float cellSize, const Vector3f& origin)
+    : width(width), height(height), depth(depth), tilesX(tileCount(width, BLOCK)),
+      tilesY(tileCount(height, BLOCK)), layout(layout), address(GridAddress::Clamp),
+      cellSize(cellSize), origin(origin) {
+    if (width < 2 || height < 2 || depth < 2) {
+        throw std::invalid_argument("Grid needs at least 2 nodes per axis");
+    }
+    if (cellSize <= 0.0f) {
+        throw std::invalid_argument("Grid cell size must be positive");
+    }
+    size_t count = layout == GridLayout::Linear
+        ? static_cast<size_t>(width) * height * depth
+        : static_cast<size_t>(tilesX) * tilesY * tileCount(depth, BLOCK) * BLOCK * BLOCK * BLOCK;
+    values.assign(count, T());
+}
+
+template<typename T>
+int Grid3D<T>::getWidth() const {
+    return width;
+}
+
+template<typename T>
+int Grid3D<T>::getHeight() const {
+    return height;
+}
+
+template<typename T>
+int Grid3D<T>::getDepth() const {
+    return depth;
+}
+
+template<typename T>
+GridLayout Grid3D<T>::getLayout() const {
+    return layout;
+}
+
+template<typename T>
+float Grid3D<T>::getCellSize() const {
+    return cellSize;
+}
+
+template<typename T>
+const Vector3f& Grid3D<T>::getOrigin() const {
+    return origin;
+}
+
+template<typename T>
+GridAddress Grid3D<T>::getAddressMode() const {
+    return address;
+}
+
+template<typename T>
+void Grid3D<T>::setAddressMode(GridAddress mode) {
+    address = mode;
+}
+
+template<typename T>
+size_t Grid3D<T>::index(int x, int y, int z) const {
+    switch (layout) {
+        case GridLayout::Blocked: return nodeIndex<GridLayout::Blocked>(x, y, z, width, height, tilesX, tilesY);
+        case GridLayout::Morton: return nodeIndex<GridLayout::Morton>(x, y, z, width, height, tilesX, tilesY);
+        default: return nodeIndex<GridLayout::Linear>(x, y, z, width, height, tilesX, tilesY);
+    }
+}
+
+template<typename T>
+T Grid3D<T>::get(int x, int y, int z) const {
+    return values[index(x, y, z)];
+}
+
+template<typename T>
+void Grid3D<T>::set(int x, int y, int z, T value) {
+    values[index(x, y, z)] = value;
+}
+
+template<typename T>
+void Grid3D<T>::fill(T value) {
+    std::fill(values.begin(), values.end(), value);
+}
+
+template<typename T>
+void Grid3D<T>::setValues(std::span<const T> source) {
+    if (source.size() != static_cast<size_t>(width) * height * depth) {
+        throw std::invalid_argument("Expected width * height * depth values");
+    }
+    size_t i = 0;
+    for (int z = 0; z < depth; ++z) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                values[index(x, y, z)] = source[i++];
+            }
+        }
+    }
+}
+
+template<typename T>
+void Grid3D<T>::getValues(std::span<T> destination) const {
+    if (destination.size() != static_cast<size_t>(width) * height * depth) {
+        throw std::invalid_argument("Expected width * height * depth values");
+    }
+    size_t i = 0;
+    for (int z = 0; z < depth; ++z) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                destination[i++] = values[index(x, y, z)];
+            }
+        }
+    }
+}
+
+template<typename T>
+template<GridLayout Layout>
+void Grid3D<T>::locate(const Vector3f& position, T corners[8], float& tx, float& ty, float& tz) const {
+    int x0, x1, y0, y1, z0, z1;
+    locateAxis((position.x - origin.x) / cellSize, width, address, x0, x1, tx);
+    locateAxis((position.y - origin.y) / cellSize, height, address, y0, y1, ty);
+    locateAxis((position.z - origin.z) / cellSize, depth, address, z0, z1, tz);
+    corners[0] = values[nodeIndex<Layout>(x0, y0, z0, width, height, tilesX, tilesY)];
+    corners[1] = values[nodeIndex<Layout>(x1, y0, z0, width, height, tilesX, tilesY)];
+    corners[2] = values[nodeIndex<Layout>(x0, y1, z0, width, height, tilesX, tilesY)];
+    corners[3] = values[nodeIndex<Layout>(x1, y1, z0, width, height, tilesX, tilesY)];
+    corners[4] = values[nodeIndex<Layout>(x0, y0, z1, width, height, tilesX, tilesY)];
+    corners[5] = values[nodeIndex<Layout>(x1, y0, z1, width, height, tilesX, tilesY)];
+    corners[6] = values[nodeIndex<Layout>(x0, y1, z1, width, height, tilesX, tilesY)];
+    corners[7] = values[nodeIndex<Layout>(x1, y1, z1, width, height, tilesX, tilesY)];
+}
+
+template<typename T>
+template<GridLayout Layout>
+T Grid3D<T>::sampleWith(const Vector3f& position) const {
+    T v[8];
+    float tx, ty, tz;
+    locate<Layout>(position, v, tx, ty, tz);
+    T front = lerp(lerp(v[0], v[1], tx), lerp(v[2], v[3], tx), ty);
+    T back = lerp(lerp(v[4], v[5], tx), lerp(v[6], v[7], tx), ty);
+    return lerp(front, back, tz);
+}
+
+template<typename T>
+template<GridLayout Layout>
+Vector3<T> Grid3D<T>::gradientWith(const Vector3f& position) const {
+    T v[8];
+    float tx, ty, tz;
+    locate<Layout>(position, v, tx, ty, tz);
+
+    // Analytic derivative of the trilinear interpolant
+    T scale = static_cast<T>(1) / static_cast<T>(cellSize);
+    T gx = lerp(lerp(v[1] - v[0], v[3] - v[2], ty), lerp(v[5] - v[4], v[7] - v[6], ty), tz);
+    T gy = lerp(lerp(v[2] - v[0], v[3] - v[1], tx), lerp(v[6] - v[4], v[7] - v[5], tx), tz);
+    T gz = lerp(lerp(v[4] - v[0], v[5] - v[1], tx), lerp(v[6] - v[2], v[7] - v[3], tx), ty);
+    return Vector3<T>(gx * scale, gy * scale, gz * scale);
+}
+
+template<typename T>
+T Grid3D<T>::sample(const Vector3f& position) const {
+    switch (layout) {
+        case GridLayout::Blocked: return sampleWith<GridLayout::Blocked>(position);
+        case GridLayout::Morton: return sampleWith<GridLayout::Morton>(position);
+        default: return values.empty() ? T() : sampleWith<GridLayout::Linear>(position);
+    }
+}
+
+template<typename T>
+Vector3<T> Grid3D<T>::gradient(const Vector3f& position) const {
+    switch (layout) {
+        case GridLayout::Blocked: return gradientWith<GridLayout::Blocked>(position);
+        case GridLayout::Morton: return gradientWith<GridLayout::Morton>(position);
+        default: return values.empty() ? Vector3<T>() : gradientWith<GridLayout::Linear>(position);
+    }
+}
+
+template<typename T>
+void Grid3D<T>::sample(std::span<const Vector3f> positions, std::span<T> out) const {
+    if (values.empty()) {
+        return;
+    }
+    // Layout chosen once, outside the loop
+    size_t count = std::min(positions.size(), out.size());
+    switch (layout) {
+        case GridLayout::Blocked:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Blocked>(positions[i]);
+            break;
+        case GridLayout::Morton:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Morton>(positions[i]);
+            break;
+        default:
+            for (size_t i = 0; i < count; ++i) out[i] = sampleWith<GridLayout::Linear>(positions[i]);
+            break;
+    }
+}
+
+template<typename T>
+void Grid3D<T>::gradient(std::span<const Vector3f> positions, std::span<Vector3<T>> out) const {
+    if (values.empty()) {
+        return;
+    }
+    size_t count = std::min(positions.size(), out.size());
+    switch (layout) {
+        case GridLayout::Blocked:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Blocked>(positions[i]);
+            break;
+        case GridLayout::Morton:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Morton>(positions[i]);
+            break;
+        default:
+            for (size_t i = 0; i < count; ++i) out[i] = gradientWith<GridLayout::Linear>(positions[i]);
+            break;
+    }
+}
+
+// Explicit template instantiations
+template class Grid2D<float>;
+template class Grid2D<double>;
+template class Grid3D<float>;
+template class Grid3D<double>;
@@ -1,4 +1,5 @@
 #include "../../include/utilities/interpolation.hpp"
+#include <algorithm>
 
 namespace Interpolation {
     template<typename T>
@@ -11,151 +12,6 @@ namespace Interpolation {
         return Quaternion<T>::slerp(a, b, t);
     }
     
-    namespace EaseFunctions {
-        float linear(float t) {
-            return t;
-        }
-        
-        float sineIn(float t) {
-            return 1 - std::cos((t * 3.14159265358979323846f) / 2);
-        }
-        
-        float sineOut(float t) {
-            return std::sin((t * 3.14159265358979323846f) / 2);
-        }
-        
-        float sineInOut(float t) {
-            return -0.5f * (std::cos(3.14159265358979323846f * t) - 1);
-        }
-        
-        float quadIn(float t) {
-            return t * t;
-        }
-        
-        float quadOut(float t) {
-            return 1 - (1 - t) * (1 - t);
-        }
-        
-        float quadInOut(float t) {
-            return t < 0.5f ? 2 * t * t : 1 - static_cast<float>(std::pow(-2 * t + 2, 2)) / 2;
-        }
-        
-        float cubicIn(float t) {
-            return t * t * t;
-        }
-        
-        float cubicOut(float t) {
-            return 1 - static_cast<float>(std::pow(1 - t, 3));
-        }
-        
-        float cubicInOut(float t) {
-            return t < 0.5f ? 4 * t * t * t : 1 - static_cast<float>(std::pow(-2 * t + 2, 3)) / 2;
-        }
-        
-        float quartIn(float t) {
-            return t * t * t * t;
-        }
-        
-        float quartOut(float t) {
-            return 1 - static_cast<float>(std::pow(1 - t, 4));
-        }
-        
-        float quartInOut(float t) {
-            return t < 0.5f ? 8 * t * t * t * t : 1 - static_cast<float>(std::pow(-2 * t + 2, 4)) / 2;
-        }
-        
-        float quintIn(float t) {
-            return t * t * t * t * t;
-        }
-        
-        float quintOut(float t) {
-            return 1 - static_cast<float>(std::pow(1 - t, 5));
-        }
-        
-        float quintInOut(float t) {
-            return t < 0.5f ? 16 * t * t * t * t * t : 1 - static_cast<float>(std::pow(-2 * t + 2, 5)) / 2;
-        }
-        
-        float expoIn(float t) {
-            return t == 0 ? 0 : static_cast<float>(std::pow(2, 10 * t - 10));
-        }
-        
-        float expoOut(float t) {
-            return t == 1 ? 1 : 1 - static_cast<float>(std::pow(2, -10 * t));
-        }
-        
-        float expoInOut(float t) {
-            return t == 0 ? 0 : t == 1 ? 1 : t < 0.5f ? static_cast<float>(std::pow(2, 20 * t - 10)) / 2 : (2 - static_cast<float>(std::pow(2, -20 * t + 10))) / 2;
-        }
-        
-        float circIn(float t) {
-            return 1 - static_cast<float>(std::sqrt(1 - static_cast<float>(std::pow(t, 2))));
-        }
-        
-        float circOut(float t) {
-            return static_cast<float>(std::sqrt(1 - static_cast<float>(std::pow(t - 1, 2))));
-        }
-        
-        float circInOut(float t) {
-            return t < 0.5f ? (1 - static_cast<float>(std::sqrt(1 - static_cast<float>(std::pow(2 * t, 2))))) / 2 : (static_cast<float>(std::sqrt(1 - static_cast<float>(std::pow(-2 * t + 2, 2)))) + 1) / 2;
-        }
-        
-        float backIn(float t) {
-            const float c1 = 1.70158f;
-            const float c3 = c1 + 1;
-            return c3 * t * t * t - c1 * t * t;
-        }
-        
-        float backOut(float t) {
-            const float c1 = 1.70158f;
-            const float c3 = c1 + 1;
-            return 1 + c3 * static_cast<float>(std::pow(t - 1, 3)) + c1 * static_cast<float>(std::pow(t - 1, 2));
-        }
-        
-        float backInOut(float t) {
-            const float c1 = 1.70158f;
-            const float c2 = c1 * 1.525f;
-            return t < 0.5f ? (static_cast<float>(std::pow(2 * t, 2)) * ((c2 + 1) * 2 * t - c2)) / 2 : (static_cast<float>(std::pow(2 * t - 2, 2)) * ((c2 + 1) * (t * 2 - 2) + c2) + 2) / 2;
-        }
-        
-        float elasticIn(float t) {
-            const float c4 = (2 * 3.14159265358979323846f) / 3;
-            return t == 0 ? 0 : t == 1 ? 1 : -static_cast<float>(std::pow(2, 10 * t - 10)) * static_cast<float>(std::sin((t * 10 - 10.75) * c4));
-        }
-        
-        float elasticOut(float t) {
-            const float c4 = (2 * 3.14159265358979323846f) / 3;
-            return t == 0 ? 0 : t == 1 ? 1 : static_cast<float>(std::pow(2, -10 * t)) * static_cast<float>(std::sin((t * 10 - 0.75) * c4)) + 1;
-        }
-        
-        float elasticInOut(float t) {
-            const float c5 = static_cast<float>(2 * 3.14159265358979323846f / 4.5f);
-            return t == 0 ? 0 : t == 1 ? 1 : t < 0.5f ? -(static_cast<float>(std::pow(2, 20 * t - 10)) * static_cast<float>(std::sin((20 * t - 11.125) * c5))) / 2 : (static_cast<float>(std::pow(2, -20 * t + 10)) * static_cast<float>(std::sin((20 * t - 11.125) * c5))) / 2 + 1;
-        }
-        
-        float bounceOut(float t) {
-            const float n1 = 7.5625;
-            const float d1 = 2.75;
-            if (t < 1.0f / d1) {
-                return n1 * t * t;
-            } else if (t < 2.0f / d1) {
-                return n1 * (t -= 1.5f / d1) * t + 0.75f;
-            } else if (t < 2.5f / d1) {
-                return n1 * (t -= 2.25f / d1) * t + 0.9375f;
-            } else {
-                return n1 * (t -= 2.625f / d1) * t + 0.984375f;
-            }
-        }
-        
-        float bounceIn(float t) {
-            return 1 - bounceOut(1 - t);
-        }
-        
-        float bounceInOut(float t) {
-            return t < 0.5f ? (1 - bounceOut(1 - 2 * t)) / 2 : (1 + bounceOut(2 * t - 1)) / 2;
-        }
-    }
-    
     float ease(float t, EaseType type) {
         switch (type) {
             case EaseType::Linear: return EaseFunctions::linear(t);
@@ -193,6 +49,55 @@ namespace Interpolation {
         }
     }
     
+    namespace {
+        template<EaseType Type>
+        void easeRange(const float* t, float* out, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = ease<Type>(t[i]);
+            }
+        }
+    }
+    
+    void easeBatch(EaseType type, std::span<const float> t, std::span<float> out) {
+        const size_t count = std::min(t.size(), out.size());
+        const float* in = t.data();
+        float* result = out.data();
+        switch (type) {
+            case EaseType::Linear: easeRange<EaseType::Linear>(in, result, count); break;
+            case EaseType::SineIn: easeRange<EaseType::SineIn>(in, result, count); break;
+            case EaseType::SineOut: easeRange<EaseType::SineOut>(in, result, count); break;
+            case EaseType::SineInOut: easeRange<EaseType::SineInOut>(in, result, count); break;
+            case EaseType::QuadIn: easeRange<EaseType::QuadIn>(in, result, count); break;
+            case EaseType::QuadOut: easeRange<EaseType::QuadOut>(in, result, count); break;
+            case EaseType::QuadInOut: easeRange<EaseType::QuadInOut>(in, result, count); break;
+            case EaseType::CubicIn: easeRange<EaseType::CubicIn>(in, result, count); break;
+            case EaseType::CubicOut: easeRange<EaseType::CubicOut>(in, result, count); break;
+            case EaseType::CubicInOut: easeRange<EaseType::CubicInOut>(in, result, count); break;
+            case EaseType::QuartIn: easeRange<EaseType::QuartIn>(in, result, count); break;
+            case EaseType::QuartOut: easeRange<EaseType::QuartOut>(in, result, count); break;
+            case EaseType::QuartInOut: easeRange<EaseType::QuartInOut>(in, result, count); break;
+            case EaseType::QuintIn: easeRange<EaseType::QuintIn>(in, result, count); break;
+            case EaseType::QuintOut: easeRange<EaseType::QuintOut>(in, result, count); break;
+            case EaseType::QuintInOut: easeRange<EaseType::QuintInOut>(in, result, count); break;
+            case EaseType::ExpoIn: easeRange<EaseType::ExpoIn>(in, result, count); break;
+            case EaseType::ExpoOut: easeRange<EaseType::ExpoOut>(in, result, count); break;
+            case EaseType::ExpoInOut: easeRange<EaseType::ExpoInOut>(in, result, count); break;
+            case EaseType::CircIn: easeRange<EaseType::CircIn>(in, result, count); break;
+            case EaseType::CircOut: easeRange<EaseType::CircOut>(in, result, count); break;
+            case EaseType::CircInOut: easeRange<EaseType::CircInOut>(in, result, count); break;
+            case EaseType::BackIn: easeRange<EaseType::BackIn>(in, result, count); break;
+            case EaseType::BackOut: easeRange<EaseType::BackOut>(in, result, count); break;
+            case EaseType::BackInOut: easeRange<EaseType::BackInOut>(in, result, count); break;
+            case EaseType::ElasticIn: easeRange<EaseType::ElasticIn>(in, result, count); break;
+            case EaseType::ElasticOut: easeRange<EaseType::ElasticOut>(in, result, count); break;
+            case EaseType::ElasticInOut: easeRange<EaseType::ElasticInOut>(in, result, count); break;
+            case EaseType::BounceIn: easeRange<EaseType::BounceIn>(in, result, count); break;
+            case EaseType::BounceOut: easeRange<EaseType::BounceOut>(in, result, count); break;
+            case EaseType::BounceInOut: easeRange<EaseType::BounceInOut>(in, result, count); break;
+            default: std::copy(in, in + count, result); break;
+        }
+    }
+    
     template<typename T>
     T easeLerp(const T& a, const T& b, float t, EaseType type) {
         return lerp(a, b, ease(t, type));
@@ -242,4 +147,49 @@ namespace Interpolation {
         if (index >= points.size() - 1) return points.back();
         return lerp(points[index], points[index + 1], localT);
     }
-}
\ No newline at end of file
+}
+// Explicit template instantiations
+namespace Interpolation {
+    template float lerp<float>(const float&, const float&, float);
+    template double lerp<double>(const double&, const double&, float);
+    template Vector2f lerp<Vector2f>(const Vector2f&, const Vector2f&, float);
+    template Vector3f lerp<Vector3f>(const Vector3f&, const Vector3f&, float);
+    template Vector4f lerp<Vector4f>(const Vector4f&, const Vector4f&, float);
+    
+    template Quaternion<float> slerp<float>(const Quaternion<float>&, const Quaternion<float>&, float);
+    template Quaternion<double> slerp<double>(const Quaternion<double>&, const Quaternion<double>&, float);
+    
+    template float easeLerp<float>(const float&, const float&, float, EaseType);
+    template double easeLerp<double>(const double&, const double&, float, EaseType);
+    template Vector2f easeLerp<Vector2f>(const Vector2f&, const Vector2f&, float, EaseType);
+    template Vector3f easeLerp<Vector3f>(const Vector3f&, const Vector3f&, float, EaseType);
+    template Vector4f easeLerp<Vector4f>(const Vector4f&, const Vector4f&, float, EaseType);
+    
+    template float cubicInterpolate<float>(const float&, const float&, const float&, const float&, float);
+    
+    template float bilinearInterpolate<float>(const float&, const float&, const float&, const float&, float, float);
+    template Vector2f bilinearInterpolate<Vector2f>(const Vector2f&, const Vector2f&, const Vector2f&, const Vector2f&, float, float);
+    template Vector3f bilinearInterpolate<Vector3f>(const Vector3f&, const Vector3f&, const Vector3f&, const Vector3f&, float, float);
+    template Vector4f bilinearInterpolate<Vector4f>(const Vector4f&, const Vector4f&, const Vector4f&, const Vector4f&, float, float);
+    
+    template float trilinearInterpolate<float>(const float&, const float&, const float&, const float&,
+                                               const float&, const float&, const float&, const float&,
+                                               float, float, float);
+    template Vector3f trilinearInterpolate<Vector3f>(const Vector3f&, const Vector3f&, const Vector3f&, const Vector3f&,
+                                                     const Vector3f&, const Vector3f&, const Vector3f&, const Vector3f&,
+                                                     float, float, float);
+    template Vector4f trilinearInterpolate<Vector4f>(const Vector4f&, const Vector4f&, const Vector4f&, const Vector4f&,
+                                                     const Vector4f&, const Vector4f&, const Vector4f&, const Vector4f&,
+                                                     float, float, float);
+    
+    template float bezier<float>(const float&, const float&, const float&, float);
+    template Vector2f bezier<Vector2f>(const Vector2f&, const Vector2f&, const Vector2f&, float);
+    template Vector3f bezier<Vector3f>(const Vector3f&, const Vector3f&, const Vector3f&, float);
+    template float bezier<float>(const float&, const float&, const float&, const float&, float);
+    template Vector2f bezier<Vector2f>(const Vector2f&, const Vector2f&, const Vector2f&, const Vector2f&, float);
+    template Vector3f bezier<Vector3f>(const Vector3f&, const Vector3f&, const Vector3f&, const Vector3f&, float);
+    
+    template float pathInterpolate<float>(const std::vector<float>&, float);
+    template Vector2f pathInterpolate<Vector2f>(const std::vector<Vector2f>&, float);
+    template Vector3f pathInterpolate<Vector3f>(const std::vector<Vector3f>&, float);
+}
@@ -1,4 +1,5 @@
 #include "../../include/utilities/intersection.hpp"
+#include <limits>
 
 namespace Intersection {
     // 2D intersections
@@ -274,6 +275,148 @@ namespace Intersection {
         return aabbsIntersect(a, b);
     }
     
+    // Watertight ray-triangle
+    namespace {
+        float component(const Vector3f& v, int k) {
+            return k == 0 ? v.x : (k == 1 ? v.y : v.z);
+        }
+    }
+    
+    WatertightRay prepareWatertightRay(const Ray<float>& ray) {
+        const Vector3f& d = ray.direction;
+        WatertightRay result;
+        result.origin = ray.origin;
+        
+        float ax = std::abs(d.x), ay = std::abs(d.y), az = std::abs(d.z);
+        result.kz = (ax > ay && ax > az) ? 0 : (ay > az ? 1 : 2);
+        result.kx = (result.kz + 1) % 3;
+        result.ky = (result.kx + 1) % 3;
+        float dz = component(d, result.kz);
+        if (dz < 0.0f) {
+            std::swap(result.kx, result.ky);
+        }
+        
+        result.sx = component(d, result.kx) / dz;
+        result.sy = component(d, result.ky) / dz;
+        result.sz = 1.0f / dz;
+        return result;
+    }
+    
+    bool rayTriangleWatertight(const WatertightRay& ray, const Vector3f& v0,
+                               const Vector3f& v1, const Vector3f& v2,
+                               float& t, Vector3f* barycentric) {
+        Vector3f a = v0 - ray.origin;
+        Vector3f b = v1 - ray.origin;
+        Vector3f c = v2 - ray.origin;
+        
+        // Shear and scale the vertices into ray space
+        float az = component(a, ray.kz), bz = component(b, ray.kz), cz = component(c, ray.kz);
+        float ax = component(a, ray.kx) - ray.sx * az;
+        float ay = component(a, ray.ky) - ray.sy * az;
+        float bx = component(b, ray.kx) - ray.sx * bz;
+        float by = component(b, ray.ky) - ray.sy * bz;
+        float cx = component(c, ray.kx) - ray.sx * cz;
+        float cy = component(c, ray.ky) - ray.sy * cz;
+        
+        float u = cx * by - cy * bx;
+        float v = ax * cy - ay * cx;
+        float w = bx * ay - by * ax;
+        
+        // Fall back to double precision when an edge test is exactly zero
+        if (u == 0.0f || v == 0.0f || w == 0.0f) {
+            u = static_cast<float>(static_cast<double>(cx) * by - static_cast<double>(cy) * bx);
+            v = static_cast<float>(static_cast<double>(ax) * cy - static_cast<double>(ay) * cx);
+            w = static_cast<float>(static_cast<double>(bx) * ay - static_cast<double>(by) * ax);
+        }
+        
+        if ((u < 0.0f || v < 0.0f || w < 0.0f) && (u > 0.0f || v > 0.0f || w > 0.0f)) {
+            return false;
+        }
+        
+        float det = u + v + w;
+        if (det == 0.0f) {
+            return false;
+        }
+        
+        float invDet = 1.0f / det;
+        float hitT = (u * az + v * bz + w * cz) * ray.sz * invDet;
+        if (hitT <= 0.0f) {
+            return false;
+        }
+        
+        t = hitT;
+        if (barycentric) {
+            *barycentric = Vector3f(u * invDet, v * invDet, w * invDet);
+        }
+        return true;
+    }
+    
+    bool rayTriangleWatertight(const Ray<float>& ray, const Vector3f& v0,
+                               const Vector3f& v1, const Vector3f& v2,
+                               float& t, Vector3f* barycentric,
+                               Vector3f* normal) {
+        if (!rayTriangleWatertight(prepareWatertightRay(ray), v0, v1, v2, t, barycentric)) {
+            return false;
+        }
+        if (normal) {
+            *normal = (v1 - v0).cross(v2 - v0).normalized();
+        }
+        return true;
+    }
+    
+    // Precomputed triangles
+    PrecomputedTriangle PrecomputedTriangle::from(const Vector3f& v0, const Vector3f& v1, const Vector3f& v2) {
+        PrecomputedTriangle triangle;
+        triangle.v0 = v0;
+        triangle.v1 = v1;
+        triangle.v2 = v2;
+        triangle.normal = (v1 - v0).cross(v2 - v0).normalized();
+        return triangle;
+    }
+    
+    PrecomputedTriangle PrecomputedTriangle::from(const Trianglef& triangle) {
+        return from(triangle.a, triangle.b, triangle.c);
+    }
+    
+    bool rayTriangle(const Ray<float>& ray, const PrecomputedTriangle& triangle,
+                     float& t, Vector3f* barycentric,
+                     Vector3f* normal) {
+        if (!rayTriangleWatertight(prepareWatertightRay(ray), triangle.v0, triangle.v1, triangle.v2, t, barycentric)) {
+            return false;
+        }
+        if (normal) {
+            *normal = triangle.normal;
+        }
+        return true;
+    }
+    
+    // Any-hit queries
+    bool rayTriangleOccluded(const Ray<float>& ray, const Vector3f& v0,
+                             const Vector3f& v1, const Vector3f& v2, float tMax) {
+        float t;
+        return rayTriangleWatertight(prepareWatertightRay(ray), v0, v1, v2, t) && t < tMax;
+    }
+    
+    bool rayTriangleOccluded(const Ray<float>& ray, const PrecomputedTriangle& triangle, float tMax) {
+        return rayTriangleOccluded(prepareWatertightRay(ray), triangle, tMax);
+    }
+    
+    bool rayTriangleOccluded(const WatertightRay& ray, const PrecomputedTriangle& triangle, float tMax) {
+        float t;
+        return rayTriangleWatertight(ray, triangle.v0, triangle.v1, triangle.v2, t) && t < tMax;
+    }
+    
+    bool rayTrianglesOccluded(const Ray<float>& ray, std::span<const PrecomputedTriangle> triangles,
+                              float tMax) {
+        const WatertightRay prepared = prepareWatertightRay(ray);
+        for (const PrecomputedTriangle& triangle : triangles) {
+            if (rayTriangleOccluded(prepared, triangle, tMax)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     // Frustum intersections (for camera)
     bool aabbInFrustum(const AABBf& aabb, const Frustum& frustum) {
         for (int i = 0; i < 6; ++i) {
@@ -298,65 +441,125 @@ namespace Intersection {
     // 3D volume intersections
     bool aabbTriangle(const AABBf& aabb, const Vector3f& v0,
                       const Vector3f& v1, const Vector3f& v2) {
-        Vector3f center = aabb.center();
-        Vector3f extents = aabb.extents();
-        Vector3f edge1 = v1 - v0;
-        Vector3f edge2 = v2 - v0;
-        Vector3f normal = edge1.cross(edge2).normalized();
-        
-        float p0 = normal.dot(v0);
-        float p1 = normal.dot(v1);
-        float p2 = normal.dot(v2);
-        float minP = std::min(std::min(p0, p1), p2);
-        float maxP = std::max(std::max(p0, p1), p2);
-        
-        float distance = normal.dot(center);
+        return aabbTriangle(aabb.center(), aabb.extents(), v0, v1, v2);
+    }
+    
+    // Akenine-Moller box/triangle overlap: 9 edge cross axes, 3 box face
+    // axes and the triangle normal
+    bool aabbTriangle(const Vector3f& center, const Vector3f& extents,
+                      const Vector3f& v0, const Vector3f& v1, const Vector3f& v2) {
+        // Move the triangle into box space
+        Vector3f a = v0 - center;
+        Vector3f b = v1 - center;
+        Vector3f c = v2 - center;
+        
+        Vector3f e0 = b - a;
+        Vector3f e1 = c - b;
+        Vector3f e2 = a - c;
+        
+        // Cross products of box axes with edges. For axis X x e the projection
+        // of two of the three vertices is identical, so only two are needed.
+        auto axisTest = [](float p0, float p1, float r) {
+            return std::min(p0, p1) > r || std::max(p0, p1) < -r;
+        };
+        const Vector3f edges[3] = { e0, e1, e2 };
+        const Vector3f* verts[3] = { &a, &b, &c };
+        for (int i = 0; i < 3; ++i) {
+            const Vector3f& e = edges[i];
+            const Vector3f& p = *verts[i];
+            const Vector3f& q = *verts[(i + 2) % 3];
+            float fx = std::abs(e.x), fy = std::abs(e.y), fz = std::abs(e.z);
+            
+            // X x e = (0, -e.z, e.y)
+            if (axisTest(e.y * p.z - e.z * p.y, e.y * q.z - e.z * q.y,
+                         fz * extents.y + fy * extents.z)) return false;
+            // Y x e = (e.z, 0, -e.x)
+            if (axisTest(e.z * p.x - e.x * p.z, e.z * q.x - e.x * q.z,
+                         fz * extents.x + fx * extents.z)) return false;
+            // Z x e = (-e.y, e.x, 0)
+            if (axisTest(e.x * p.y - e.y * p.x, e.x * q.y - e.y * q.x,
+                         fy * extents.x + fx * extents.y)) return false;
+        }
+        
+        // Box face normals: triangle bounds against the box
+        if (std::min({a.x, b.x, c.x}) > extents.x || std::max({a.x, b.x, c.x}) < -extents.x) return false;
+        if (std::min({a.y, b.y, c.y}) > extents.y || std::max({a.y, b.y, c.y}) < -extents.y) return false;
+        if (std::min({a.z, b.z, c.z}) > extents.z || std::max({a.z, b.z, c.z}) < -extents.z) return false;
+        
+        // Triangle normal: plane against box
+        Vector3f normal = e0.cross(e1);
+        float distance = normal.dot(a);
         float radius = extents.x * std::abs(normal.x) + extents.y * std::abs(normal.y) + extents.z * std::abs(normal.z);
         
-        return !(distance + radius < minP || distance - radius > maxP);
+        return std::abs(distance) <= radius;
     }
     
     // SAT (Separating Axis Theorem) for convex polygons
     bool satTest2D(const std::vector<Vector2f>& poly1,
                    const std::vector<Vector2f>& poly2) {
-        std::vector<Vector2f> axes;
-        
-        for (size_t i = 0; i < poly1.size(); ++i) {
-            Vector2f edge = poly1[(i + 1) % poly1.size()] - poly1[i];
-            Vector2f normal = Vector2f(-edge.y, edge.x).normalized();
-            axes.push_back(normal);
+        const std::vector<Vector2f>* polys[2] = { &poly1, &poly2 };
+        
+        for (const auto* poly : polys) {
+            for (size_t i = 0; i < poly->size(); ++i) {
+                Vector2f edge = (*poly)[(i + 1) % poly->size()] - (*poly)[i];
+                Vector2f axis = Vector2f(-edge.y, edge.x).normalized();
+                
+                float min1 = std::numeric_limits<float>::max();
+                float max1 = -std::numeric_limits<float>::max();
+                float min2 = std::numeric_limits<float>::max();
+                float max2 = -std::numeric_limits<float>::max();
+                
+                for (const auto& point : poly1) {
+                    float projection = point.dot(axis);
+                    min1 = std::min(min1, projection);
+                    max1 = std::max(max1, projection);
+                }
+                
+                for (const auto& point : poly2) {
+                    float projection = point.dot(axis);
+                    min2 = std::min(min2, projection);
+                    max2 = std::max(max2, projection);
+                }
+                
+                if (max1 < min2 || max2 < min1) {
+                    return false;
+                }
+            }
         }
         
-        for (size_t i = 0; i < poly2.size(); ++i) {
-            Vector2f edge = poly2[(i + 1) % poly2.size()] - poly2[i];
-            Vector2f normal = Vector2f(-edge.y, edge.x).normalized();
-            axes.push_back(normal);
-        }
+        return true;
+    }
+    
+    bool satTest2D(const ConvexPolygon2Df& poly1, const ConvexPolygon2Df& poly2,
+                   Vector2f* mtv) {
+        return poly1.intersects(poly2, mtv);
+    }
+    
+    size_t satTest2DBatch(const ConvexPolygon2Df& poly,
+                          std::span<const ConvexPolygon2Df> others,
+                          std::span<uint32_t> hitIndices,
+                          std::span<Vector2f> mtvs) {
+        const bool writeMtv = !mtvs.empty();
+        const size_t capacity = writeMtv ? std::min(hitIndices.size(), mtvs.size()) : hitIndices.size();
+        size_t hits = 0;
         
-        for (const auto& axis : axes) {
-            float min1 = std::numeric_limits<float>::max();
-            float max1 = -std::numeric_limits<float>::max();
-            float min2 = std::numeric_limits<float>::max();
-            float max2 = -std::numeric_limits<float>::max();
-            
-            for (const auto& point : poly1) {
-                float projection = point.dot(axis);
-                min1 = std::min(min1, projection);
-                max1 = std::max(max1, projection);
-            }
-            
-            for (const auto& point : poly2) {
-                float projection = point.dot(axis);
-                min2 = std::min(min2, projection);
-                max2 = std::max(max2, projection);
+        // Hits past capacity are still counted so callers can detect truncation
+        for (size_t i = 0; i < others.size(); ++i) {
+            if (hits >= capacity) {
+                hits += poly.intersects(others[i]) ? 1 : 0;
+                continue;
             }
-            
-            if (max1 < min2 || max2 < min1) {
-                return false;
+            Vector2f mtv;
+            if (poly.intersects(others[i], writeMtv ? &mtv : nullptr)) {
+                hitIndices[hits] = static_cast<uint32_t>(i);
+                if (writeMtv) {
+                    mtvs[hits] = mtv;
+                }
+                ++hits;
             }
         }
         
-        return true;
+        return hits;
     }
     
     // Intersection point calculation
@@ -382,6 +585,166 @@ namespace Intersection {
         return std::abs((point - planePoint).dot(planeNormal)) / planeNormal.length();
     }
     
+    // Closest points on primitives (Ericson, Real-Time Collision Detection 5.1)
+    Vector3f closestPointSegment(const Vector3f& point, const Vector3f& a, const Vector3f& b) {
+        Vector3f ab = b - a;
+        float lengthSquared = ab.dot(ab);
+        float t = lengthSquared > 0.0f ? (point - a).dot(ab) / lengthSquared : 0.0f;
+        return a + ab * std::clamp(t, 0.0f, 1.0f);
+    }
+    
+    Vector3f closestPointAABB(const Vector3f& point, const AABBf& aabb) {
+        return Vector3f(
+            std::min(std::max(point.x, aabb.min.x), aabb.max.x),
+            std::min(std::max(point.y, aabb.min.y), aabb.max.y),
+            std::min(std::max(point.z, aabb.min.z), aabb.max.z)
+        );
+    }
+    
+    Vector3f closestPointOBB(const Vector3f& point, const OBBf& obb) {
+        Vector3f d = point - obb.center;
+        float x = std::min(std::max(d.dot(obb.axes[0]), -obb.extents.x), obb.extents.x);
+        float y = std::min(std::max(d.dot(obb.axes[1]), -obb.extents.y), obb.extents.y);
+        float z = std::min(std::max(d.dot(obb.axes[2]), -obb.extents.z), obb.extents.z);
+        return obb.center + obb.axes[0] * x + obb.axes[1] * y + obb.axes[2] * z;
+    }
+    
+    Vector3f closestPointTriangle(const Vector3f& point, const Vector3f& v0,
+                                  const Vector3f& v1, const Vector3f& v2) {
+        Vector3f ab = v1 - v0;
+        Vector3f ac = v2 - v0;
+        Vector3f ap = point - v0;
+        float d1 = ab.dot(ap);
+        float d2 = ac.dot(ap);
+        if (d1 <= 0.0f && d2 <= 0.0f) return v0;
+        
+        Vector3f bp = point - v1;
+        float d3 = ab.dot(bp);
+        float d4 = ac.dot(bp);
+        if (d3 >= 0.0f && d4 <= d3) return v1;
+        
+        float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            return v0 + ab * (d1 / (d1 - d3));
+        }
+        
+        Vector3f cp = point - v2;
+        float d5 = ab.dot(cp);
+        float d6 = ac.dot(cp);
+        if (d6 >= 0.0f && d5 <= d6) return v2;
+        
+        float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            return v0 + ac * (d2 / (d2 - d6));
+        }
+        
+        float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+            return v1 + (v2 - v1) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+        
+        float denom = 1.0f / (va + vb + vc);
+        return v0 + ab * (vb * denom) + ac * (vc * denom);
+    }
+    
+    float distancePointToTriangle(const Vector3f& point, const Vector3f& v0,
+                                  const Vector3f& v1, const Vector3f& v2) {
+        return (point - closestPointTriangle(point, v0, v1, v2)).length();
+    }
+    
+    float distancePointToOBB(const Vector3f& point, const OBBf& obb) {
+        return (point - closestPointOBB(point, obb)).length();
+    }
+    
+    // Closest points between primitives
+    float closestPointsSegmentSegment(const Vector3f& p1, const Vector3f& q1,
+                                      const Vector3f& p2, const Vector3f& q2,
+                                      Vector3f& c1, Vector3f& c2) {
+        Vector3f d1 = q1 - p1;
+        Vector3f d2 = q2 - p2;
+        Vector3f r = p1 - p2;
+        float a = d1.dot(d1);
+        float e = d2.dot(d2);
+        float f = d2.dot(r);
+        float s = 0.0f;
+        float t = 0.0f;
+        
+        if (a <= 1e-12f && e <= 1e-12f) {
+            c1 = p1;
+            c2 = p2;
+            return (c1 - c2).dot(c1 - c2);
+        }
+        if (a <= 1e-12f) {
+            t = std::clamp(f / e, 0.0f, 1.0f);
+        } else {
+            float c = d1.dot(r);
+            if (e <= 1e-12f) {
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            } else {
+                float b = d1.dot(d2);
+                float denom = a * e - b * b;
+                s = denom != 0.0f ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+                t = (b * s + f) / e;
+                if (t < 0.0f) {
+                    t = 0.0f;
+                    s = std::clamp(-c / a, 0.0f, 1.0f);
+                } else if (t > 1.0f) {
+                    t = 1.0f;
+                    s = std::clamp((b - c) / a, 0.0f, 1.0f);
+                }
+            }
+        }
+        
+        c1 = p1 + d1 * s;
+        c2 = p2 + d2 * t;
+        return (c1 - c2).dot(c1 - c2);
+    }
+    
+    float closestPointsSegmentTriangle(const Vector3f& p, const Vector3f& q,
+                                       const Vector3f& v0, const Vector3f& v1, const Vector3f& v2,
+                                       Vector3f& onSegment, Vector3f& onTriangle) {
+        // A segment piercing the triangle has distance zero
+        Vector3f normal = (v1 - v0).cross(v2 - v0);
+        float dp = (p - v0).dot(normal);
+        float dq = (q - v0).dot(normal);
+        if ((dp <= 0.0f && dq >= 0.0f) || (dp >= 0.0f && dq <= 0.0f)) {
+            float denom = dp - dq;
+            Vector3f hit = denom != 0.0f ? p + (q - p) * (dp / denom) : p;
+            Vector3f bary = triangleBarycentric(hit, v0, v1, v2);
+            if (bary.x >= 0.0f && bary.y >= 0.0f && bary.z >= 0.0f) {
+                onSegment = hit;
+                onTriangle = hit;
+                return 0.0f;
+            }
+        }
+        
+        // Otherwise the minimum is at a segment endpoint or on a triangle edge
+        onSegment = p;
+        onTriangle = closestPointTriangle(p, v0, v1, v2);
+        float best = (p - onTriangle).dot(p - onTriangle);
+        
+        Vector3f onTriQ = closestPointTriangle(q, v0, v1, v2);
+        float dist = (q - onTriQ).dot(q - onTriQ);
+        if (dist < best) {
+            best = dist;
+            onSegment = q;
+            onTriangle = onTriQ;
+        }
+        
+        const Vector3f* verts[3] = { &v0, &v1, &v2 };
+        for (int i = 0; i < 3; ++i) {
+            Vector3f c1, c2;
+            dist = closestPointsSegmentSegment(p, q, *verts[i], *verts[(i + 1) % 3], c1, c2);
+            if (dist < best) {
+                best = dist;
+                onSegment = c1;
+                onTriangle = c2;
+            }
+        }
+        
+        return best;
+    }
+    
     // Point classification relative to plane
     PlaneSide classifyPointToPlane(const Vector3f& point,
                                    const Vector3f& planePoint,
@@ -0,0 +1,21 @@
+#include "../../include/utilities/parallel.hpp"
+
+namespace Parallel {
+    size_t defaultThreadCount() {
+        // hardware_concurrency() can be a system call; it is queried once
+        static const size_t count = [] {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            return hardware > 0 ? static_cast<size_t>(hardware) : size_t(1);
+        }();
+        return count;
+    }
+    
+    size_t workerCount(size_t count, size_t threadCount, size_t minPerWorker) {
+        if (threadCount == 0) {
+            threadCount = defaultThreadCount();
+        }
+        minPerWorker = std::max<size_t>(minPerWorker, 1);
+        size_t byWork = (count + minPerWorker - 1) / minPerWorker;
+        return std::max<size_t>(1, std::min(threadCount, byWork));
+    }
+}
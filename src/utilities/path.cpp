@@ -0,0 +1,198 @@
+#include "../../include/utilities/path.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr size_t MAX_SCAN = 4;
+
+    template<typename T>
+    T catmullRom(const T& p0, const T& p1, const T& p2, const T& p3, float t) {
+        return p1 + (p2 - p0 + (p0 * 2.0f - p1 * 5.0f + p2 * 4.0f - p3 + (p1 * 3.0f - p2 * 3.0f + p3 - p0) * t) * t) * (0.5f * t);
+    }
+
+    template<typename T>
+    T cubicBezier(const T& p0, const T& p1, const T& p2, const T& p3, float t) {
+        float u = 1.0f - t;
+        return p0 * (u * u * u) + p1 * (3.0f * u * u * t) + p2 * (3.0f * u * t * t) + p3 * (t * t * t);
+    }
+}
+
+// Construction
+
+template<typename T>
+Path<T>::Path() : type(SegmentType::Linear), subdivisions(DEFAULT_SUBDIVISIONS) {
+    distances.push_back(0.0f);
+}
+
+template<typename T>
+Path<T>::Path(std::span<const T> points, SegmentType type, size_t subdivisions)
+    : type(type), subdivisions(subdivisions) {
+    build(points, type, subdivisions);
+}
+
+template<typename T>
+void Path<T>::build(std::span<const T> points, SegmentType type, size_t subdivisions) {
+    if (type == SegmentType::Bezier && !points.empty() && points.size() % 3 != 1) {
+        throw std::invalid_argument("Bezier path needs 3n + 1 control points");
+    }
+    if (subdivisions == 0) {
+        throw std::invalid_argument("Path needs at least one subdivision per segment");
+    }
+    this->points.assign(points.begin(), points.end());
+    this->type = type;
+    this->subdivisions = type == SegmentType::Linear ? 1 : subdivisions;
+    uniform.clear();
+
+    // Chord lengths of every segment, accumulated
+    size_t chords = segmentCount() * this->subdivisions;
+    distances.resize(chords + 1);
+    distances[0] = 0.0f;
+    T previous = evaluate(0.0f);
+    for (size_t i = 1; i <= chords; ++i) {
+        T current = evaluate(static_cast<float>(i) / static_cast<float>(this->subdivisions));
+        distances[i] = distances[i - 1] + (current - previous).length();
+        previous = current;
+    }
+}
+
+template<typename T>
+void Path<T>::buildUniformTable(size_t size) {
+    if (size < 2) {
+        throw std::invalid_argument("Uniform table needs at least 2 entries");
+    }
+    std::vector<float> table(size);
+    const float total = length();
+    for (size_t i = 0; i < size; ++i) {
+        table[i] = parameterAtDistance(total * static_cast<float>(i) / static_cast<float>(size - 1));
+    }
+    uniform = std::move(table);
+}
+
+template<typename T>
+bool Path<T>::hasUniformTable() const {
+    return !uniform.empty();
+}
+
+// Evaluation
+
+template<typename T>
+T Path<T>::evaluate(float u) const {
+    if (points.size() < 2) {
+        return points.empty() ? T() : points[0];
+    }
+    const size_t segments = segmentCount();
+    u = std::clamp(u, 0.0f, static_cast<float>(segments));
+    size_t segment = std::min(static_cast<size_t>(u), segments - 1);
+    float f = u - static_cast<float>(segment);
+
+    switch (type) {
+        case SegmentType::CatmullRom: {
+            const T& p0 = points[segment > 0 ? segment - 1 : 0];
+            const T& p3 = points[std::min(segment + 2, points.size() - 1)];
+            return catmullRom(p0, points[segment], points[segment + 1], p3, f);
+        }
+        case SegmentType::Bezier: {
+            const T* p = points.data() + segment * 3;
+            return cubicBezier(p[0], p[1], p[2], p[3], f);
+        }
+        default:
+            return points[segment] + (points[segment + 1] - points[segment]) * f;
+    }
+}
+
+template<typename T>
+float Path<T>::parameterFromChord(size_t chord, float distance) const {
+    float chordLength = distances[chord + 1] - distances[chord];
+    float f = chordLength > 0.0f ? (distance - distances[chord]) / chordLength : 0.0f;
+    return (static_cast<float>(chord) + std::clamp(f, 0.0f, 1.0f)) / static_cast<float>(subdivisions);
+}
+
+template<typename T>
+float Path<T>::parameterAtDistance(float distance) const {
+    if (distances.size() < 2) {
+        return 0.0f;
+    }
+    distance = std::clamp(distance, 0.0f, distances.back());
+    size_t chord = std::upper_bound(distances.begin(), distances.end(), distance) - distances.begin();
+    chord = std::min(chord > 0 ? chord - 1 : 0, distances.size() - 2);
+    return parameterFromChord(chord, distance);
+}
+
+template<typename T>
+T Path<T>::sampleAtDistance(float distance) const {
+    return evaluate(parameterAtDistance(distance));
+}
+
+template<typename T>
+T Path<T>::sample(float t) const {
+    t = std::clamp(t, 0.0f, 1.0f);
+    if (!uniform.empty()) {
+        float x = t * static_cast<float>(uniform.size() - 1);
+        size_t i = std::min(static_cast<size_t>(x), uniform.size() - 2);
+        float f = x - static_cast<float>(i);
+        return evaluate(uniform[i] + (uniform[i + 1] - uniform[i]) * f);
+    }
+    return sampleAtDistance(t * length());
+}
+
+template<typename T>
+void Path<T>::sample(std::span<const float> t, std::span<T> out) const {
+    const size_t count = std::min(t.size(), out.size());
+    if (!uniform.empty() || distances.size() < 2) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = sample(t[i]);
+        }
+        return;
+    }
+
+    // Walk forward from the previous chord while t increases, search otherwise
+    const float total = length();
+    const size_t lastChord = distances.size() - 2;
+    size_t chord = 0;
+    for (size_t i = 0; i < count; ++i) {
+        float distance = std::clamp(t[i], 0.0f, 1.0f) * total;
+        if (distance < distances[chord]) {
+            chord = 0;
+        }
+        size_t scanned = 0;
+        while (chord < lastChord && distances[chord + 1] <= distance && scanned < MAX_SCAN) {
+            ++chord;
+            ++scanned;
+        }
+        if (chord < lastChord && distances[chord + 1] <= distance) {
+            chord = std::upper_bound(distances.begin() + chord, distances.end(), distance) - distances.begin() - 1;
+            chord = std::min(chord, lastChord);
+        }
+        out[i] = evaluate(parameterFromChord(chord, distance));
+    }
+}
+
+// Properties
+
+template<typename T>
+float Path<T>::length() const {
+    return distances.back();
+}
+
+template<typename T>
+size_t Path<T>::segmentCount() const {
+    if (points.size() < 2) {
+        return 0;
+    }
+    return type == SegmentType::Bezier ? (points.size() - 1) / 3 : points.size() - 1;
+}
+
+template<typename T>
+typename Path<T>::SegmentType Path<T>::getSegmentType() const {
+    return type;
+}
+
+template<typename T>
+const std::vector<T>& Path<T>::getPoints() const {
+    return points;
+}
+
+// Explicit template instantiations
+template class Path<Vector2f>;
+template class Path<Vector3f>;
@@ -0,0 +1,216 @@
+#include "../../include/utilities/polyline.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    template<typename T>
+    float distanceSquaredToSegment(const T& point, const T& a, const T& b) {
+        T ab = b - a;
+        T ap = point - a;
+        float lengthSquared = ab.dot(ab);
+        float t = lengthSquared > 0.0f ? std::clamp(ap.dot(ab) / lengthSquared, 0.0f, 1.0f) : 0.0f;
+        T offset = ap - ab * t;
+        return offset.dot(offset);
+    }
+
+    // Triangle area from Lagrange's identity, so 2D and 3D share it
+    template<typename T>
+    float triangleArea(const T& a, const T& b, const T& c) {
+        T ab = b - a;
+        T ac = c - a;
+        float d = ab.dot(ac);
+        return 0.5f * std::sqrt(std::max(ab.dot(ab) * ac.dot(ac) - d * d, 0.0f));
+    }
+}
+
+// Ramer-Douglas-Peucker
+
+template<typename T>
+void Polyline::simplifyRDP(std::span<const T> points, float tolerance, std::vector<T>& out) {
+    if (tolerance < 0.0f) {
+        throw std::invalid_argument("Simplification tolerance must not be negative");
+    }
+    out.clear();
+    if (points.size() < 3) {
+        out.assign(points.begin(), points.end());
+        return;
+    }
+
+    const float toleranceSquared = tolerance * tolerance;
+    std::vector<uint8_t> keep(points.size(), 0);
+    keep.front() = keep.back() = 1;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    ranges.emplace_back(0, points.size() - 1);
+    while (!ranges.empty()) {
+        auto [first, last] = ranges.back();
+        ranges.pop_back();
+
+        float farthest = -1.0f;
+        size_t index = first;
+        for (size_t i = first + 1; i < last; ++i) {
+            float d = distanceSquaredToSegment(points[i], points[first], points[last]);
+            if (d > farthest) {
+                farthest = d;
+                index = i;
+            }
+        }
+        if (farthest > toleranceSquared) {
+            keep[index] = 1;
+            if (index - first > 1) {
+                ranges.emplace_back(first, index);
+            }
+            if (last - index > 1) {
+                ranges.emplace_back(index, last);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (keep[i]) {
+            out.push_back(points[i]);
+        }
+    }
+}
+
+// Visvalingam-Whyatt
+
+template<typename T>
+void Polyline::simplifyVisvalingam(std::span<const T> points, float minArea, std::vector<T>& out, size_t minPoints) {
+    out.clear();
+    const size_t n = points.size();
+    minPoints = std::max<size_t>(minPoints, 2);
+    if (n <= minPoints) {
+        out.assign(points.begin(), points.end());
+        return;
+    }
+
+    // Doubly linked list over the points, with a min-heap of triangle areas.
+    // Heap entries go stale when a neighbour is removed; they are recognised
+    // by their area no longer matching the point's current one.
+    std::vector<size_t> previous(n), next(n);
+    std::vector<float> area(n, std::numeric_limits<float>::max());
+    using Entry = std::pair<float, size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (size_t i = 0; i < n; ++i) {
+        previous[i] = i - 1;
+        next[i] = i + 1;
+        if (i > 0 && i + 1 < n) {
+            area[i] = triangleArea(points[i - 1], points[i], points[i + 1]);
+            heap.emplace(area[i], i);
+        }
+    }
+
+    std::vector<uint8_t> removed(n, 0);
+    size_t remaining = n;
+    while (!heap.empty() && remaining > minPoints) {
+        auto [smallest, i] = heap.top();
+        heap.pop();
+        if (removed[i] || smallest != area[i]) {
+            continue;
+        }
+        if (smallest >= minArea) {
+            break;
+        }
+        removed[i] = 1;
+        --remaining;
+        size_t p = previous[i];
+        size_t q = next[i];
+        next[p] = q;
+        previous[q] = p;
+
+        // Neighbours never drop below the removed area, so removal order stays monotonic
+        if (p > 0) {
+            area[p] = std::max(triangleArea(points[previous[p]], points[p], points[q]), smallest);
+            heap.emplace(area[p], p);
+        }
+        if (q + 1 < n) {
+            area[q] = std::max(triangleArea(points[p], points[q], points[next[q]]), smallest);
+            heap.emplace(area[q], q);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!removed[i]) {
+            out.push_back(points[i]);
+        }
+    }
+}
+
+// StreamingResampler
+
+template<typename T>
+StreamingResampler<T>::StreamingResampler(float spacing)
+    : spacing(spacing), carried(0.0f), travelled(0.0f), started(false) {
+    if (!(spacing > 0.0f)) {
+        throw std::invalid_argument("Resampling spacing must be positive");
+    }
+}
+
+template<typename T>
+size_t StreamingResampler<T>::push(const T& point, std::vector<T>& out) {
+    if (!started) {
+        started = true;
+        last = point;
+        carried = 0.0f;
+        out.push_back(point);
+        return 1;
+    }
+
+    T segment = point - last;
+    float length = segment.length();
+    size_t emitted = 0;
+    if (length > 0.0f) {
+        // Distance along this segment to the next sample
+        float d = spacing - carried;
+        while (d <= length) {
+            out.push_back(last + segment * (d / length));
+            ++emitted;
+            d += spacing;
+        }
+        carried = length - (d - spacing);
+        travelled += length;
+    }
+    last = point;
+    return emitted;
+}
+
+template<typename T>
+size_t StreamingResampler<T>::finish(std::vector<T>& out) {
+    if (!started || carried <= spacing * 1e-4f) {
+        return 0;
+    }
+    out.push_back(last);
+    carried = 0.0f;
+    return 1;
+}
+
+template<typename T>
+void StreamingResampler<T>::reset() {
+    carried = 0.0f;
+    travelled = 0.0f;
+    started = false;
+}
+
+template<typename T>
+float StreamingResampler<T>::getSpacing() const {
+    return spacing;
+}
+
+template<typename T>
+float StreamingResampler<T>::distanceTravelled() const {
+    return travelled;
+}
+
+// Explicit template instantiations
+template void Polyline::simplifyRDP<Vector2f>(std::span<const Vector2f>, float, std::vector<Vector2f>&);
+template void Polyline::simplifyRDP<Vector3f>(std::span<const Vector3f>, float, std::vector<Vector3f>&);
+template void Polyline::simplifyVisvalingam<Vector2f>(std::span<const Vector2f>, float, std::vector<Vector2f>&, size_t);
+template void Polyline::simplifyVisvalingam<Vector3f>(std::span<const Vector3f>, float, std::vector<Vector3f>&, size_t);
+
+template class StreamingResampler<Vector2f>;
+template class StreamingResampler<Vector3f>;
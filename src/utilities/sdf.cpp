@@ -0,0 +1,277 @@
+#include "../../include/utilities/sdf.hpp"
+#include "../../include/utilities/intersection.hpp"
+#include "../../include/utilities/interpolation.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include "../../include/utilities/voxelizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Constructors
+
+SignedDistanceField::SignedDistanceField() : bounds(), cellSize(1.0f), resolution(0, 0, 0) {}
+
+SignedDistanceField::SignedDistanceField(const AABBf& bounds, float cellSize) : cellSize(cellSize) {
+    if (cellSize <= 0.0f) {
+        throw std::invalid_argument("Cell size must be positive");
+    }
+    Vector3f size = bounds.size();
+    resolution = Vector3i(
+        std::max(2, static_cast<int>(std::ceil(size.x / cellSize)) + 1),
+        std::max(2, static_cast<int>(std::ceil(size.y / cellSize)) + 1),
+        std::max(2, static_cast<int>(std::ceil(size.z / cellSize)) + 1)
+    );
+    this->bounds = AABBf(bounds.min, bounds.min + Vector3f(
+        static_cast<float>(resolution.x - 1), static_cast<float>(resolution.y - 1), static_cast<float>(resolution.z - 1)) * cellSize);
+    values.assign(static_cast<size_t>(resolution.x) * resolution.y * resolution.z, std::numeric_limits<float>::max());
+}
+
+// Baking
+
+namespace {
+    struct BakeState {
+        std::vector<float> distance;
+        std::vector<int32_t> closest;
+    };
+
+    float triangleDistance(const Vector3f& point, std::span<const Vector3f> vertices,
+                           std::span<const uint32_t> indices, int32_t triangle) {
+        const uint32_t* tri = &indices[static_cast<size_t>(triangle) * 3];
+        return (point - Intersection::closestPointTriangle(point, vertices[tri[0]], vertices[tri[1]], vertices[tri[2]])).length();
+    }
+}
+
+SignedDistanceField SignedDistanceField::bake(std::span<const Vector3f> vertices,
+                                              std::span<const uint32_t> indices,
+                                              float cellSize, float padding,
+                                              int bandCells, size_t threadCount) {
+    AABBf meshBounds = Voxelizer::meshBounds(vertices);
+    Vector3f margin(padding + cellSize, padding + cellSize, padding + cellSize);
+    SignedDistanceField sdf(AABBf(meshBounds.min - margin, meshBounds.max + margin), cellSize);
+
+    const Vector3i res = sdf.resolution;
+    const Vector3f origin = sdf.bounds.min;
+    const size_t triangles = indices.size() / 3;
+    BakeState state;
+    state.distance.assign(sdf.values.size(), std::numeric_limits<float>::max());
+    state.closest.assign(sdf.values.size(), -1);
+
+    // Exact distances near the surface; each worker owns a slab of z layers
+    Parallel::forRange(static_cast<size_t>(res.z), threadCount, 1, [&](size_t slabBegin, size_t slabEnd, size_t) {
+        const int z0 = static_cast<int>(slabBegin);
+        const int z1 = static_cast<int>(slabEnd) - 1;
+        for (size_t t = 0; t < triangles; ++t) {
+            const Vector3f& a = vertices[indices[t * 3]];
+            const Vector3f& b = vertices[indices[t * 3 + 1]];
+            const Vector3f& c = vertices[indices[t * 3 + 2]];
+            auto lo = [&](float v0, float v1, float v2, float start, int limit) {
+                return std::clamp(static_cast<int>(std::floor((std::min({v0, v1, v2}) - start) / cellSize)) - bandCells, 0, limit);
+            };
+            auto hi = [&](float v0, float v1, float v2, float start, int limit) {
+                return std::clamp(static_cast<int>(std::ceil((std::max({v0, v1, v2}) - start) / cellSize)) + bandCells, 0, limit);
+            };
+            int minZ = std::max(lo(a.z, b.z, c.z, origin.z, res.z - 1), z0);
+            int maxZ = std::min(hi(a.z, b.z, c.z, origin.z, res.z - 1), z1);
+            if (minZ > maxZ) {
+                continue;
+            }
+            int minX = lo(a.x, b.x, c.x, origin.x, res.x - 1), maxX = hi(a.x, b.x, c.x, origin.x, res.x - 1);
+            int minY = lo(a.y, b.y, c.y, origin.y, res.y - 1), maxY = hi(a.y, b.y, c.y, origin.y, res.y - 1);
+
+            for (int z = minZ; z <= maxZ; ++z) {
+                for (int y = minY; y <= maxY; ++y) {
+                    for (int x = minX; x <= maxX; ++x) {
+                        size_t i = sdf.index(x, y, z);
+                        Vector3f p = sdf.nodePosition(x, y, z);
+                        float d = (p - Intersection::closestPointTriangle(p, a, b, c)).length();
+                        if (d < state.distance[i]) {
+                            state.distance[i] = d;
+                            state.closest[i] = static_cast<int32_t>(t);
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    // Fast sweeping: propagate closest triangles along grid lines, one axis at a
+    // time. Lines are independent, so each pass is split across workers.
+    const int dims[3] = { res.x, res.y, res.z };
+    const size_t strides[3] = { 1, static_cast<size_t>(res.x), static_cast<size_t>(res.x) * res.y };
+    for (int round = 0; round < 2; ++round) {
+        for (int axis = 0; axis < 3; ++axis) {
+            const int u = (axis + 1) % 3;
+            const int v = (axis + 2) % 3;
+            const size_t lines = static_cast<size_t>(dims[u]) * dims[v];
+            Parallel::forRange(lines, threadCount, 64, [&](size_t begin, size_t end, size_t) {
+                for (size_t line = begin; line < end; ++line) {
+                    int coord[3];
+                    coord[u] = static_cast<int>(line % dims[u]);
+                    coord[v] = static_cast<int>(line / dims[u]);
+                    coord[axis] = 0;
+                    const size_t base = sdf.index(coord[0], coord[1], coord[2]);
+
+                    auto relax = [&](int step, int from) {
+                        size_t i = base + static_cast<size_t>(step) * strides[axis];
+                        int32_t candidate = state.closest[base + static_cast<size_t>(from) * strides[axis]];
+                        if (candidate < 0 || candidate == state.closest[i]) {
+                            return;
+                        }
+                        coord[axis] = step;
+                        float d = triangleDistance(sdf.nodePosition(coord[0], coord[1], coord[2]), vertices, indices, candidate);
+                        if (d < state.distance[i]) {
+                            state.distance[i] = d;
+                            state.closest[i] = candidate;
+                        }
+                    };
+                    for (int s = 1; s < dims[axis]; ++s) {
+                        relax(s, s - 1);
+                    }
+                    for (int s = dims[axis] - 2; s >= 0; --s) {
+                        relax(s, s + 1);
+                    }
+                }
+            });
+        }
+    }
+
+    // Sign from interior parity, with voxel centers placed on the SDF nodes
+    Vector3f half(cellSize * 0.5f, cellSize * 0.5f, cellSize * 0.5f);
+    Vector3f extent = Vector3f(static_cast<float>(res.x), static_cast<float>(res.y), static_cast<float>(res.z)) * cellSize;
+    VoxelGrid inside(AABBf(origin - half, origin - half + extent), cellSize);
+    Voxelizer::voxelize(inside, vertices, indices, Voxelizer::FillMode::Interior, threadCount);
+
+    for (int z = 0; z < res.z; ++z) {
+        for (int y = 0; y < res.y; ++y) {
+            for (int x = 0; x < res.x; ++x) {
+                size_t i = sdf.index(x, y, z);
+                sdf.values[i] = inside.get(x, y, z) ? -state.distance[i] : state.distance[i];
+            }
+        }
+    }
+
+    return sdf;
+}
+
+// Properties
+
+const AABBf& SignedDistanceField::getBounds() const {
+    return bounds;
+}
+
+float SignedDistanceField::getCellSize() const {
+    return cellSize;
+}
+
+Vector3i SignedDistanceField::getResolution() const {
+    return resolution;
+}
+
+size_t SignedDistanceField::index(int x, int y, int z) const {
+    return (static_cast<size_t>(z) * resolution.y + y) * resolution.x + x;
+}
+
+float SignedDistanceField::get(int x, int y, int z) const {
+    return values[index(x, y, z)];
+}
+
+void SignedDistanceField::set(int x, int y, int z, float value) {
+    values[index(x, y, z)] = value;
+}
+
+Vector3f SignedDistanceField::nodePosition(int x, int y, int z) const {
+    return bounds.min + Vector3f(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * cellSize;
+}
+
+// Queries
+
+void SignedDistanceField::locate(const Vector3f& point, int& x, int& y, int& z, Vector3f& t) const {
+    Vector3f local = (point - bounds.min) / cellSize;
+    local.x = std::clamp(local.x, 0.0f, static_cast<float>(resolution.x - 1));
+    local.y = std::clamp(local.y, 0.0f, static_cast<float>(resolution.y - 1));
+    local.z = std::clamp(local.z, 0.0f, static_cast<float>(resolution.z - 1));
+    x = std::min(static_cast<int>(local.x), resolution.x - 2);
+    y = std::min(static_cast<int>(local.y), resolution.y - 2);
+    z = std::min(static_cast<int>(local.z), resolution.z - 2);
+    t = Vector3f(local.x - x, local.y - y, local.z - z);
+}
+
+float SignedDistanceField::sample(const Vector3f& point) const {
+    if (values.empty()) {
+        return std::numeric_limits<float>::max();
+    }
+    int x, y, z;
+    Vector3f t;
+    locate(point, x, y, z, t);
+
+    const size_t sx = 1;
+    const size_t sy = static_cast<size_t>(resolution.x);
+    const size_t sz = sy * resolution.y;
+    const float* v = &values[index(x, y, z)];
+    float distance = Interpolation::trilinearInterpolate(v[0], v[sx], v[sy], v[sx + sy],
+                                                         v[sz], v[sx + sz], v[sy + sz], v[sx + sy + sz],
+                                                         t.x, t.y, t.z);
+
+    // Outside the grid, continue with the distance to its bounds
+    return distance + bounds.distanceTo(point);
+}
+
+Vector3f SignedDistanceField::gradient(const Vector3f& point) const {
+    if (values.empty()) {
+        return Vector3f();
+    }
+    int x, y, z;
+    Vector3f t;
+    locate(point, x, y, z, t);
+
+    const size_t sx = 1;
+    const size_t sy = static_cast<size_t>(resolution.x);
+    const size_t sz = sy * resolution.y;
+    const float* v = &values[index(x, y, z)];
+    const float v000 = v[0], v100 = v[sx], v010 = v[sy], v110 = v[sx + sy];
+    const float v001 = v[sz], v101 = v[sx + sz], v011 = v[sy + sz], v111 = v[sx + sy + sz];
+
+    // Analytic derivative of the trilinear interpolant
+    float gx = Interpolation::bilinearInterpolate(v100 - v000, v110 - v010, v101 - v001, v111 - v011, t.y, t.z);
+    float gy = Interpolation::bilinearInterpolate(v010 - v000, v110 - v100, v011 - v001, v111 - v101, t.x, t.z);
+    float gz = Interpolation::bilinearInterpolate(v001 - v000, v101 - v100, v011 - v010, v111 - v110, t.x, t.y);
+    return Vector3f(gx, gy, gz) / cellSize;
+}
+
+Vector3f SignedDistanceField::normal(const Vector3f& point) const {
+    return gradient(point).normalized();
+}
+
+void SignedDistanceField::sample(std::span<const Vector3f> points, std::span<float> distances) const {
+    size_t count = std::min(points.size(), distances.size());
+    for (size_t i = 0; i < count; ++i) {
+        distances[i] = sample(points[i]);
+    }
+}
+
+bool SignedDistanceField::sphereTrace(const Ray<float>& ray, float maxDistance, float& t,
+                                      int maxSteps, float epsilon) const {
+    float length = ray.direction.length();
+    if (length == 0.0f || values.empty()) {
+        return false;
+    }
+    Ray<float> unitRay(ray.origin, ray.direction / length);
+
+    float tMin, tMax;
+    if (!Intersection::rayAABB(unitRay, bounds, tMin, tMax)) {
+        return false;
+    }
+    float s = std::max(tMin, 0.0f);
+    float end = std::min(tMax, maxDistance);
+
+    for (int step = 0; step < maxSteps && s <= end; ++step) {
+        float distance = sample(unitRay.pointAt(s));
+        if (distance < epsilon) {
+            t = s / length;
+            return true;
+        }
+        s += distance;
+    }
+    return false;
+}
@@ -0,0 +1,246 @@
+#include "../../include/utilities/spline.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    template<typename T>
+    float distanceToSegment(const T& point, const T& a, const T& b) {
+        T ab = b - a;
+        float lengthSquared = ab.dot(ab);
+        float t = lengthSquared > 0.0f ? std::clamp((point - a).dot(ab) / lengthSquared, 0.0f, 1.0f) : 0.0f;
+        return (point - (a + ab * t)).length();
+    }
+
+    template<typename T>
+    T evaluateSegment(const typename CubicSpline<T>::Segment& s, float t) {
+        return s.a + (s.b + (s.c + s.d * t) * t) * t;
+    }
+
+    template<typename T>
+    void flattenRange(const typename CubicSpline<T>::Segment& s, float t0, float t1, const T& p0, const T& p1,
+                      float tolerance, int depth, std::vector<T>& out) {
+        // Three interior samples catch S-shaped spans whose midpoint lies on the chord
+        float h = (t1 - t0) * 0.25f;
+        T q1 = evaluateSegment<T>(s, t0 + h);
+        T mid = evaluateSegment<T>(s, t0 + 2.0f * h);
+        T q3 = evaluateSegment<T>(s, t0 + 3.0f * h);
+        bool flat = distanceToSegment(q1, p0, p1) <= tolerance &&
+                    distanceToSegment(mid, p0, p1) <= tolerance &&
+                    distanceToSegment(q3, p0, p1) <= tolerance;
+        if (flat || depth <= 0) {
+            out.push_back(p1);
+            return;
+        }
+        float tm = t0 + 2.0f * h;
+        flattenRange<T>(s, t0, tm, p0, mid, tolerance, depth - 1, out);
+        flattenRange<T>(s, tm, t1, mid, p1, tolerance, depth - 1, out);
+    }
+}
+
+// CubicSpline
+
+template<typename T>
+size_t CubicSpline<T>::segmentCount() const {
+    return segments.size();
+}
+
+template<typename T>
+const std::vector<typename CubicSpline<T>::Segment>& CubicSpline<T>::getSegments() const {
+    return segments;
+}
+
+template<typename T>
+T CubicSpline<T>::evaluate(float u) const {
+    if (segments.empty()) {
+        return T();
+    }
+    u = std::clamp(u, 0.0f, static_cast<float>(segments.size()));
+    size_t i = std::min(static_cast<size_t>(u), segments.size() - 1);
+    return evaluateSegment<T>(segments[i], u - static_cast<float>(i));
+}
+
+template<typename T>
+T CubicSpline<T>::derivative(float u) const {
+    if (segments.empty()) {
+        return T();
+    }
+    u = std::clamp(u, 0.0f, static_cast<float>(segments.size()));
+    size_t i = std::min(static_cast<size_t>(u), segments.size() - 1);
+    float t = u - static_cast<float>(i);
+    const Segment& s = segments[i];
+    return s.b + (s.c * 2.0f + s.d * (3.0f * t)) * t;
+}
+
+template<typename T>
+T CubicSpline<T>::secondDerivative(float u) const {
+    if (segments.empty()) {
+        return T();
+    }
+    u = std::clamp(u, 0.0f, static_cast<float>(segments.size()));
+    size_t i = std::min(static_cast<size_t>(u), segments.size() - 1);
+    float t = u - static_cast<float>(i);
+    return segments[i].c * 2.0f + segments[i].d * (6.0f * t);
+}
+
+template<typename T>
+T CubicSpline<T>::tangent(float u) const {
+    T d = derivative(u);
+    float length = d.length();
+    return length > 0.0f ? d / length : d;
+}
+
+template<typename T>
+void CubicSpline<T>::evaluate(std::span<const float> u, std::span<T> out) const {
+    const size_t count = std::min(u.size(), out.size());
+    if (segments.empty()) {
+        std::fill(out.begin(), out.begin() + count, T());
+        return;
+    }
+    const float end = static_cast<float>(segments.size());
+    const size_t last = segments.size() - 1;
+    const Segment* data = segments.data();
+    for (size_t k = 0; k < count; ++k) {
+        float x = std::clamp(u[k], 0.0f, end);
+        size_t i = std::min(static_cast<size_t>(x), last);
+        out[k] = evaluateSegment<T>(data[i], x - static_cast<float>(i));
+    }
+}
+
+template<typename T>
+void CubicSpline<T>::derivative(std::span<const float> u, std::span<T> out) const {
+    const size_t count = std::min(u.size(), out.size());
+    if (segments.empty()) {
+        std::fill(out.begin(), out.begin() + count, T());
+        return;
+    }
+    const float end = static_cast<float>(segments.size());
+    const size_t last = segments.size() - 1;
+    const Segment* data = segments.data();
+    for (size_t k = 0; k < count; ++k) {
+        float x = std::clamp(u[k], 0.0f, end);
+        size_t i = std::min(static_cast<size_t>(x), last);
+        float t = x - static_cast<float>(i);
+        out[k] = data[i].b + (data[i].c * 2.0f + data[i].d * (3.0f * t)) * t;
+    }
+}
+
+template<typename T>
+void CubicSpline<T>::flatten(float tolerance, std::vector<T>& out, int maxDepth) const {
+    if (tolerance <= 0.0f) {
+        throw std::invalid_argument("Flattening tolerance must be positive");
+    }
+    out.clear();
+    if (segments.empty()) {
+        return;
+    }
+    out.push_back(segments[0].a);
+    for (const Segment& s : segments) {
+        flattenRange<T>(s, 0.0f, 1.0f, s.a, evaluateSegment<T>(s, 1.0f), tolerance, maxDepth, out);
+    }
+}
+
+// CatmullRomSpline
+
+template<typename T>
+CatmullRomSpline<T>::CatmullRomSpline() {}
+
+template<typename T>
+CatmullRomSpline<T>::CatmullRomSpline(std::span<const T> points) {
+    build(points);
+}
+
+template<typename T>
+void CatmullRomSpline<T>::build(std::span<const T> points) {
+    if (points.size() == 1) {
+        throw std::invalid_argument("Catmull-Rom spline needs at least 2 points");
+    }
+    this->segments.clear();
+    for (size_t i = 0; i + 1 < points.size(); ++i) {
+        const T& p0 = points[i > 0 ? i - 1 : 0];
+        const T& p1 = points[i];
+        const T& p2 = points[i + 1];
+        const T& p3 = points[std::min(i + 2, points.size() - 1)];
+        this->segments.push_back({ p1,
+                                   (p2 - p0) * 0.5f,
+                                   p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f,
+                                   (p1 - p2) * 1.5f + (p3 - p0) * 0.5f });
+    }
+}
+
+// CubicBezierSpline
+
+template<typename T>
+CubicBezierSpline<T>::CubicBezierSpline() {}
+
+template<typename T>
+CubicBezierSpline<T>::CubicBezierSpline(std::span<const T> controlPoints) {
+    build(controlPoints);
+}
+
+template<typename T>
+void CubicBezierSpline<T>::build(std::span<const T> controlPoints) {
+    if (!controlPoints.empty() && (controlPoints.size() < 4 || controlPoints.size() % 3 != 1)) {
+        throw std::invalid_argument("Cubic Bezier spline needs 3n + 1 control points");
+    }
+    this->segments.clear();
+    for (size_t i = 0; i + 3 < controlPoints.size(); i += 3) {
+        const T& p0 = controlPoints[i];
+        const T& p1 = controlPoints[i + 1];
+        const T& p2 = controlPoints[i + 2];
+        const T& p3 = controlPoints[i + 3];
+        this->segments.push_back({ p0,
+                                   (p1 - p0) * 3.0f,
+                                   (p0 - p1 * 2.0f + p2) * 3.0f,
+                                   p3 - p0 + (p1 - p2) * 3.0f });
+    }
+}
+
+// BSpline
+
+template<typename T>
+BSpline<T>::BSpline() {}
+
+template<typename T>
+BSpline<T>::BSpline(std::span<const T> controlPoints, bool clampEnds) {
+    build(controlPoints, clampEnds);
+}
+
+template<typename T>
+void BSpline<T>::build(std::span<const T> controlPoints, bool clampEnds) {
+    this->segments.clear();
+    if (controlPoints.empty()) {
+        return;
+    }
+    std::vector<T> points;
+    if (clampEnds) {
+        points.insert(points.end(), 2, controlPoints.front());
+    }
+    points.insert(points.end(), controlPoints.begin(), controlPoints.end());
+    if (clampEnds) {
+        points.insert(points.end(), 2, controlPoints.back());
+    }
+    if (points.size() < 4) {
+        throw std::invalid_argument("B-spline needs at least 4 control points");
+    }
+    for (size_t i = 0; i + 3 < points.size(); ++i) {
+        const T& p0 = points[i];
+        const T& p1 = points[i + 1];
+        const T& p2 = points[i + 2];
+        const T& p3 = points[i + 3];
+        this->segments.push_back({ (p0 + p1 * 4.0f + p2) / 6.0f,
+                                   (p2 - p0) * 0.5f,
+                                   (p0 - p1 * 2.0f + p2) * 0.5f,
+                                   (p3 - p0 + (p1 - p2) * 3.0f) / 6.0f });
+    }
+}
+
+// Explicit template instantiations
+template class CubicSpline<Vector2f>;
+template class CubicSpline<Vector3f>;
+template class CatmullRomSpline<Vector2f>;
+template class CatmullRomSpline<Vector3f>;
+template class CubicBezierSpline<Vector2f>;
+template class CubicBezierSpline<Vector3f>;
+template class BSpline<Vector2f>;
+template class BSpline<Vector3f>;
@@ -0,0 +1,429 @@
+#include "../../include/utilities/voxelizer.hpp"
+#include "../../include/utilities/intersection.hpp"
+#include "../../include/utilities/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// VoxelGrid
+
+VoxelGrid::VoxelGrid() : bounds(), voxelSize(1.0f), resolution(0, 0, 0) {}
+
+VoxelGrid::VoxelGrid(const AABBf& bounds, float voxelSize) : voxelSize(voxelSize) {
+    if (voxelSize <= 0.0f) {
+        throw std::invalid_argument("Voxel size must be positive");
+    }
+    Vector3f size = bounds.size();
+    resolution = Vector3i(
+        std::max(1, static_cast<int>(std::ceil(size.x / voxelSize))),
+        std::max(1, static_cast<int>(std::ceil(size.y / voxelSize))),
+        std::max(1, static_cast<int>(std::ceil(size.z / voxelSize)))
+    );
+    this->bounds = AABBf(bounds.min, bounds.min + Vector3f(
+        static_cast<float>(resolution.x), static_cast<float>(resolution.y), static_cast<float>(resolution.z)) * voxelSize);
+
+    size_t cells = static_cast<size_t>(resolution.x) * resolution.y * resolution.z;
+    words.assign((cells + 63) / 64, 0);
+}
+
+const AABBf& VoxelGrid::getBounds() const {
+    return bounds;
+}
+
+float VoxelGrid::getVoxelSize() const {
+    return voxelSize;
+}
+
+Vector3i VoxelGrid::getResolution() const {
+    return resolution;
+}
+
+size_t VoxelGrid::index(int x, int y, int z) const {
+    return (static_cast<size_t>(z) * resolution.y + y) * resolution.x + x;
+}
+
+bool VoxelGrid::get(int x, int y, int z) const {
+    if (!inBounds(x, y, z)) {
+        return false;
+    }
+    size_t i = index(x, y, z);
+    return (words[i >> 6] >> (i & 63)) & 1;
+}
+
+void VoxelGrid::set(int x, int y, int z, bool value) {
+    if (!inBounds(x, y, z)) {
+        return;
+    }
+    size_t i = index(x, y, z);
+    uint64_t bit = uint64_t(1) << (i & 63);
+    if (value) {
+        words[i >> 6] |= bit;
+    } else {
+        words[i >> 6] &= ~bit;
+    }
+}
+
+void VoxelGrid::setAtomic(int x, int y, int z) {
+    if (!inBounds(x, y, z)) {
+        return;
+    }
+    size_t i = index(x, y, z);
+    std::atomic_ref<uint64_t>(words[i >> 6]).fetch_or(uint64_t(1) << (i & 63), std::memory_order_relaxed);
+}
+
+bool VoxelGrid::inBounds(int x, int y, int z) const {
+    return x >= 0 && y >= 0 && z >= 0 &&
+           x < resolution.x && y < resolution.y && z < resolution.z;
+}
+
+Vector3i VoxelGrid::worldToVoxel(const Vector3f& point) const {
+    Vector3f local = (point - bounds.min) / voxelSize;
+    return Vector3i(static_cast<int>(std::floor(local.x)),
+                    static_cast<int>(std::floor(local.y)),
+                    static_cast<int>(std::floor(local.z)));
+}
+
+Vector3f VoxelGrid::voxelCenter(int x, int y, int z) const {
+    return bounds.min + Vector3f(x + 0.5f, y + 0.5f, z + 0.5f) * voxelSize;
+}
+
+AABBf VoxelGrid::voxelBounds(int x, int y, int z) const {
+    Vector3f min = bounds.min + Vector3f(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * voxelSize;
+    return AABBf(min, min + Vector3f(voxelSize, voxelSize, voxelSize));
+}
+
+size_t VoxelGrid::countFilled() const {
+    size_t filled = 0;
+    for (uint64_t word : words) {
+        filled += static_cast<size_t>(std::popcount(word));
+    }
+    return filled;
+}
+
+void VoxelGrid::clear() {
+    std::fill(words.begin(), words.end(), 0);
+}
+
+// SparseVoxelGrid
+
+SparseVoxelGrid::SparseVoxelGrid() : origin(), voxelSize(1.0f) {}
+
+SparseVoxelGrid::SparseVoxelGrid(const Vector3f& origin, float voxelSize) : origin(origin), voxelSize(voxelSize) {
+    if (voxelSize <= 0.0f) {
+        throw std::invalid_argument("Voxel size must be positive");
+    }
+}
+
+const Vector3f& SparseVoxelGrid::getOrigin() const {
+    return origin;
+}
+
+float SparseVoxelGrid::getVoxelSize() const {
+    return voxelSize;
+}
+
+uint64_t SparseVoxelGrid::brickKey(int bx, int by, int bz) {
+    // 21 bits per axis, two's complement wrapped
+    const uint64_t mask = (uint64_t(1) << 21) - 1;
+    return ((static_cast<uint64_t>(bx) & mask) << 42) |
+           ((static_cast<uint64_t>(by) & mask) << 21) |
+           (static_cast<uint64_t>(bz) & mask);
+}
+
+bool SparseVoxelGrid::get(int x, int y, int z) const {
+    auto it = bricks.find(brickKey(x >> 3, y >> 3, z >> 3));
+    if (it == bricks.end()) {
+        return false;
+    }
+    return (it->second[z & 7] >> ((y & 7) * 8 + (x & 7))) & 1;
+}
+
+void SparseVoxelGrid::set(int x, int y, int z, bool value) {
+    uint64_t bit = uint64_t(1) << ((y & 7) * 8 + (x & 7));
+    uint64_t key = brickKey(x >> 3, y >> 3, z >> 3);
+    if (value) {
+        bricks[key][z & 7] |= bit;
+        return;
+    }
+    auto it = bricks.find(key);
+    if (it != bricks.end()) {
+        it->second[z & 7] &= ~bit;
+    }
+}
+
+Vector3i SparseVoxelGrid::worldToVoxel(const Vector3f& point) const {
+    Vector3f local = (point - origin) / voxelSize;
+    return Vector3i(static_cast<int>(std::floor(local.x)),
+                    static_cast<int>(std::floor(local.y)),
+                    static_cast<int>(std::floor(local.z)));
+}
+
+Vector3f SparseVoxelGrid::voxelCenter(int x, int y, int z) const {
+    return origin + Vector3f(x + 0.5f, y + 0.5f, z + 0.5f) * voxelSize;
+}
+
+size_t SparseVoxelGrid::brickCount() const {
+    return bricks.size();
+}
+
+size_t SparseVoxelGrid::countFilled() const {
+    size_t filled = 0;
+    for (const auto& [key, brick] : bricks) {
+        for (uint64_t slice : brick) {
+            filled += static_cast<size_t>(std::popcount(slice));
+        }
+    }
+    return filled;
+}
+
+void SparseVoxelGrid::merge(const SparseVoxelGrid& other) {
+    for (const auto& [key, brick] : other.bricks) {
+        Brick& target = bricks[key];
+        for (int i = 0; i < BRICK_SIZE; ++i) {
+            target[i] |= brick[i];
+        }
+    }
+}
+
+void SparseVoxelGrid::clear() {
+    bricks.clear();
+}
+
+const std::unordered_map<uint64_t, SparseVoxelGrid::Brick>& SparseVoxelGrid::getBricks() const {
+    return bricks;
+}
+
+// Voxelizer
+
+namespace {
+    // Minimum triangles per worker before another thread is started
+    constexpr size_t TRIANGLES_PER_WORKER = 256;
+
+    struct ColumnCrossing {
+        int64_t column;
+        float z;
+
+        bool operator<(const ColumnCrossing& other) const {
+            return column < other.column || (column == other.column && z < other.z);
+        }
+    };
+
+    struct VoxelRange {
+        int minX, minY, minZ;
+        int maxX, maxY, maxZ;
+    };
+
+    VoxelRange triangleRange(const Vector3f& origin, float voxelSize,
+                             const Vector3f& a, const Vector3f& b, const Vector3f& c) {
+        auto cell = [&](float value, float start) {
+            return static_cast<int>(std::floor((value - start) / voxelSize));
+        };
+        return VoxelRange{
+            cell(std::min({a.x, b.x, c.x}), origin.x),
+            cell(std::min({a.y, b.y, c.y}), origin.y),
+            cell(std::min({a.z, b.z, c.z}), origin.z),
+            cell(std::max({a.x, b.x, c.x}), origin.x),
+            cell(std::max({a.y, b.y, c.y}), origin.y),
+            cell(std::max({a.z, b.z, c.z}), origin.z)
+        };
+    }
+
+    // Calls emit(x, y, z) for every voxel overlapped by the triangle
+    template<typename Emit>
+    void rasterizeSurface(const Vector3f& origin, float voxelSize, const VoxelRange& limits,
+                          const Vector3f& a, const Vector3f& b, const Vector3f& c, Emit&& emit) {
+        VoxelRange range = triangleRange(origin, voxelSize, a, b, c);
+        range.minX = std::max(range.minX, limits.minX); range.maxX = std::min(range.maxX, limits.maxX);
+        range.minY = std::max(range.minY, limits.minY); range.maxY = std::min(range.maxY, limits.maxY);
+        range.minZ = std::max(range.minZ, limits.minZ); range.maxZ = std::min(range.maxZ, limits.maxZ);
+
+        const float half = voxelSize * 0.5f;
+        const Vector3f extents(half, half, half);
+        for (int z = range.minZ; z <= range.maxZ; ++z) {
+            for (int y = range.minY; y <= range.maxY; ++y) {
+                for (int x = range.minX; x <= range.maxX; ++x) {
+                    Vector3f center = origin + Vector3f(x + 0.5f, y + 0.5f, z + 0.5f) * voxelSize;
+                    if (Intersection::aabbTriangle(center, extents, a, b, c)) {
+                        emit(x, y, z);
+                    }
+                }
+            }
+        }
+    }
+
+    // Top-left tie rule: an edge shared by two triangles owns a column center
+    // lying exactly on it for only one of them
+    bool edgeOwns(double w, double dx, double dy) {
+        return w > 0 || (w == 0 && (dy > 0 || (dy == 0 && dx < 0)));
+    }
+
+    // Records where the triangle crosses +Z columns through voxel centers
+    template<typename Emit>
+    void rasterizeCrossings(const Vector3f& origin, float voxelSize, const VoxelRange& limits,
+                            Vector3f a, Vector3f b, Vector3f c, Emit&& emit) {
+        double area = (double(b.x) - a.x) * (double(c.y) - a.y) - (double(b.y) - a.y) * (double(c.x) - a.x);
+        if (area == 0) {
+            return;
+        }
+        if (area < 0) {
+            std::swap(b, c);
+            area = -area;
+        }
+
+        VoxelRange range = triangleRange(origin, voxelSize, a, b, c);
+        range.minX = std::max(range.minX, limits.minX); range.maxX = std::min(range.maxX, limits.maxX);
+        range.minY = std::max(range.minY, limits.minY); range.maxY = std::min(range.maxY, limits.maxY);
+
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            double py = origin.y + (y + 0.5) * voxelSize;
+            for (int x = range.minX; x <= range.maxX; ++x) {
+                double px = origin.x + (x + 0.5) * voxelSize;
+                double w0 = (double(c.x) - b.x) * (py - b.y) - (double(c.y) - b.y) * (px - b.x);
+                double w1 = (double(a.x) - c.x) * (py - c.y) - (double(a.y) - c.y) * (px - c.x);
+                double w2 = (double(b.x) - a.x) * (py - a.y) - (double(b.y) - a.y) * (px - a.x);
+                if (edgeOwns(w0, double(c.x) - b.x, double(c.y) - b.y) &&
+                    edgeOwns(w1, double(a.x) - c.x, double(a.y) - c.y) &&
+                    edgeOwns(w2, double(b.x) - a.x, double(b.y) - a.y)) {
+                    float z = static_cast<float>((w0 * a.z + w1 * b.z + w2 * c.z) / area);
+                    emit(x, y, z);
+                }
+            }
+        }
+    }
+
+    int64_t columnKey(int x, int y) {
+        return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+    }
+
+    // Collects column crossings for all triangles in parallel, sorted by column then z
+    std::vector<ColumnCrossing> collectCrossings(const Vector3f& origin, float voxelSize, const VoxelRange& limits,
+                                                 std::span<const Vector3f> vertices,
+                                                 std::span<const uint32_t> indices, size_t threadCount) {
+        size_t triangles = indices.size() / 3;
+        size_t workers = Parallel::workerCount(triangles, threadCount, TRIANGLES_PER_WORKER);
+        std::vector<std::vector<ColumnCrossing>> local(workers);
+
+        Parallel::forRange(triangles, workers, TRIANGLES_PER_WORKER, [&](size_t begin, size_t end, size_t worker) {
+            auto& out = local[worker];
+            for (size_t t = begin; t < end; ++t) {
+                rasterizeCrossings(origin, voxelSize, limits,
+                                   vertices[indices[t * 3]], vertices[indices[t * 3 + 1]], vertices[indices[t * 3 + 2]],
+                                   [&](int x, int y, float z) { out.push_back({ columnKey(x, y), z }); });
+            }
+        });
+
+        std::vector<ColumnCrossing> crossings;
+        for (auto& part : local) {
+            crossings.insert(crossings.end(), part.begin(), part.end());
+        }
+        std::sort(crossings.begin(), crossings.end());
+        return crossings;
+    }
+
+    // Fills voxels whose centers lie between pairs of crossings in each column
+    template<typename Fill>
+    void fillInterior(const std::vector<ColumnCrossing>& crossings, float originZ, float voxelSize, Fill&& fill) {
+        size_t i = 0;
+        while (i < crossings.size()) {
+            size_t end = i;
+            while (end < crossings.size() && crossings[end].column == crossings[i].column) {
+                ++end;
+            }
+            int x = static_cast<int>(crossings[i].column >> 32);
+            int y = static_cast<int>(static_cast<uint32_t>(crossings[i].column & 0xFFFFFFFF));
+            for (size_t k = i; k + 1 < end; k += 2) {
+                int z0 = static_cast<int>(std::ceil((crossings[k].z - originZ) / voxelSize - 0.5f));
+                int z1 = static_cast<int>(std::ceil((crossings[k + 1].z - originZ) / voxelSize - 0.5f));
+                for (int z = z0; z < z1; ++z) {
+                    fill(x, y, z);
+                }
+            }
+            i = end;
+        }
+    }
+}
+
+namespace Voxelizer {
+    AABBf meshBounds(std::span<const Vector3f> vertices) {
+        if (vertices.empty()) {
+            return AABBf();
+        }
+        AABBf bounds(vertices[0], vertices[0]);
+        for (const Vector3f& v : vertices) {
+            bounds.expand(v);
+        }
+        return bounds;
+    }
+
+    VoxelGrid voxelize(std::span<const Vector3f> vertices,
+                       std::span<const uint32_t> indices,
+                       float voxelSize, FillMode mode, size_t threadCount) {
+        AABBf bounds = meshBounds(vertices);
+        Vector3f pad(voxelSize, voxelSize, voxelSize);
+        VoxelGrid grid(AABBf(bounds.min - pad, bounds.max + pad), voxelSize);
+        voxelize(grid, vertices, indices, mode, threadCount);
+        return grid;
+    }
+
+    void voxelize(VoxelGrid& grid, std::span<const Vector3f> vertices,
+                  std::span<const uint32_t> indices,
+                  FillMode mode, size_t threadCount) {
+        const Vector3f origin = grid.getBounds().min;
+        const float voxelSize = grid.getVoxelSize();
+        const Vector3i res = grid.getResolution();
+        const VoxelRange limits{ 0, 0, 0, res.x - 1, res.y - 1, res.z - 1 };
+        size_t triangles = indices.size() / 3;
+
+        if (mode != FillMode::Interior) {
+            Parallel::forRange(triangles, threadCount, TRIANGLES_PER_WORKER, [&](size_t begin, size_t end, size_t) {
+                for (size_t t = begin; t < end; ++t) {
+                    rasterizeSurface(origin, voxelSize, limits,
+                                     vertices[indices[t * 3]], vertices[indices[t * 3 + 1]], vertices[indices[t * 3 + 2]],
+                                     [&](int x, int y, int z) { grid.setAtomic(x, y, z); });
+                }
+            });
+        }
+
+        if (mode != FillMode::Surface) {
+            auto crossings = collectCrossings(origin, voxelSize, limits, vertices, indices, threadCount);
+            fillInterior(crossings, origin.z, voxelSize, [&](int x, int y, int z) { grid.set(x, y, z); });
+        }
+    }
+
+    SparseVoxelGrid voxelizeSparse(std::span<const Vector3f> vertices,
+                                   std::span<const uint32_t> indices,
+                                   float voxelSize, FillMode mode, size_t threadCount) {
+        Vector3f origin = meshBounds(vertices).min;
+        SparseVoxelGrid grid(origin, voxelSize);
+        const int unbounded = std::numeric_limits<int>::max();
+        const VoxelRange limits{ -unbounded, -unbounded, -unbounded, unbounded, unbounded, unbounded };
+        size_t triangles = indices.size() / 3;
+
+        // Each worker fills a private grid; the results are unioned afterwards
+        size_t workers = Parallel::workerCount(triangles, threadCount, TRIANGLES_PER_WORKER);
+        std::vector<SparseVoxelGrid> local(workers, SparseVoxelGrid(origin, voxelSize));
+        if (mode != FillMode::Interior) {
+            Parallel::forRange(triangles, workers, TRIANGLES_PER_WORKER, [&](size_t begin, size_t end, size_t worker) {
+                SparseVoxelGrid& out = local[worker];
+                for (size_t t = begin; t < end; ++t) {
+                    rasterizeSurface(origin, voxelSize, limits,
+                                     vertices[indices[t * 3]], vertices[indices[t * 3 + 1]], vertices[indices[t * 3 + 2]],
+                                     [&](int x, int y, int z) { out.set(x, y, z); });
+                }
+            });
+            for (const auto& part : local) {
+                grid.merge(part);
+            }
+        }
+
+        if (mode != FillMode::Surface) {
+            auto crossings = collectCrossings(origin, voxelSize, limits, vertices, indices, threadCount);
+            fillInterior(crossings, origin.z, voxelSize, [&](int x, int y, int z) { grid.set(x, y, z); });
+        }
+
+        return grid;
+    }
+}
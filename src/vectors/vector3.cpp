@@ -27,6 +27,11 @@ Vector3<T> Vector3<T>::operator*(T scalar) const {
     return Vector3<T>(x * scalar, y * scalar, z * scalar);
 }
 
+template<typename T>
+Vector3<T> Vector3<T>::operator*(const Vector3<T>& other) const {
+    return Vector3<T>(x * other.x, y * other.y, z * other.z);
+}
+
 template<typename T>
 Vector3<T> Vector3<T>::operator/(T scalar) const {
     return Vector3<T>(x / scalar, y / scalar, z / scalar);